@@ -6,6 +6,7 @@ IF ERRORLEVEL 1 exit /b 1
 
 del qb64pe_bootstrap.exe
 del /q /s internal\source\*
+del /q internal\temp\*.o
 move internal\temp\* internal\source\
 
 REM Build libqb test executables
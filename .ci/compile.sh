@@ -10,6 +10,7 @@ rm internal/source/*
 rm internal/temp/debug_* internal/temp/recompile_*
 rm internal/temp/qb64pe.sym
 rm internal/temp/qb64pe_bootstrap.sym
+rm -f internal/temp/*.o
 
 mv internal/temp/* internal/source/
 
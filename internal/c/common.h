@@ -119,6 +119,7 @@ struct ontimer_struct {
     uint8 state;      // 0=untriggered,1=triggered
     double seconds;   // how many seconds between events
     double last_time; // the last time this event was triggered
+    uint32 schedule;  // bumped whenever the timer is (re)scheduled, older entries in the timer queue are ignored
 };
 
 struct onkey_struct {
@@ -14,10 +14,12 @@
 
 #include "audio.h"
 #include "bitops.h"
+#include "blit.h"
 #include "cmem.h"
 #include "command.h"
 #include "completion.h"
 #include "compression.h"
+#include "console.h"
 #include "datetime.h"
 #include "encoding.h"
 #include "error_handle.h"
@@ -445,7 +447,8 @@ enum class stream_type {
 // Purpose: Unify access to the input and/or output of streamed data
 struct stream_struct {
     uint8 *in;
-    ptrszint in_size;  // current size in bytes
+    ptrszint in_start; // read cursor, unread data starts at in + in_start
+    ptrszint in_size;  // current size in bytes (of unread data)
     ptrszint in_limit; // size before reallocation of buffer is required
     int8 eof;          // user attempted to read past end of stream
     // Note: 'out' is unrequired because data can be sent directly to the interface
@@ -457,13 +460,39 @@ struct stream_struct {
 
 list *stream_handles = NULL;
 
+// The 'in' buffer starts at STREAM_IN_MIN_LIMIT bytes and doubles as data arrives, up to STREAM_IN_MAX_LIMIT
+// or the size of the read waiting on it, whichever is larger. Past that, stream_update() stops reading and leaves
+// the data queued in the OS socket buffer.
+static const ptrszint STREAM_IN_MIN_LIMIT = 1024;
+static const ptrszint STREAM_IN_MAX_LIMIT = 64 * 1024 * 1024;
+// An emptied buffer larger than this is shrunk back down to STREAM_IN_MIN_LIMIT
+static const ptrszint STREAM_IN_SHRINK_LIMIT = 1024 * 1024;
+
 void stream_free(stream_struct *st) {
     if (st->in_limit)
         free(st->in);
     list_remove(stream_handles, list_get_index(stream_handles, st));
 }
 
-void stream_update(stream_struct *stream);
+// Removes 'bytes' of unread data from the front of the 'in' buffer. This only advances the read cursor, the
+// remaining data is moved back to the start of the buffer by stream_update(), once the consumed part is at least half
+// of the buffer or a pending read needs the room.
+void stream_consume(stream_struct *st, ptrszint bytes) {
+    st->in_start += bytes;
+    st->in_size -= bytes;
+
+    if (!st->in_size) {
+        st->in_start = 0;
+
+        if (st->in_limit > STREAM_IN_SHRINK_LIMIT) {
+            st->in = (uint8 *)realloc(st->in, STREAM_IN_MIN_LIMIT);
+            st->in_limit = STREAM_IN_MIN_LIMIT;
+        }
+    }
+}
+
+// wanted: the number of bytes a pending read needs, the buffer is allowed to grow past STREAM_IN_MAX_LIMIT to hold them
+void stream_update(stream_struct *stream, ptrszint wanted = 0);
 void stream_out(stream_struct *st, void *offset, ptrszint bytes);
 
 void connection_close(ptrszint i);
@@ -1781,6 +1810,7 @@ void FreeConsole() {
 
 extern void QBMAIN(void *);
 extern void TIMERTHREAD(void *);
+extern void wake_timer_thread();
 void MAIN_LOOP(void *);
 
 void GLUT_MAINLOOP_THREAD(void *);
@@ -3494,62 +3524,6 @@ uint32 *fimg = (uint32 *)malloc(IMG_BUFFERSIZE * 4); // a list to recover freed
 int32 nfimg = IMG_BUFFERSIZE;
 int32 lastfimg = -1; //-1=no freed indexes exist
 
-uint8 *cblend = NULL;
-uint8 *ablend = NULL;
-uint8 *ablend127;
-uint8 *ablend128;
-
-// to save 16MB of RAM, software blend tables are only allocated if a 32-bit image is created
-void init_blend() {
-    uint8 *cp;
-    int32 i, x2, x3, i2, z;
-    float f, f2, f3;
-    cblend = (uint8 *)malloc(16777216);
-    cp = cblend;
-    for (i = 0; i < 256; i++) {            // source alpha
-        for (x2 = 0; x2 < 256; x2++) {     // source
-            for (x3 = 0; x3 < 256; x3++) { // dest
-                f = i;
-                f2 = x2;
-                f3 = x3;
-                f /= 255.0;                                             // 0.0-1.0
-                *cp++ = qbr_float_to_long((f * f2) + ((1.0 - f) * f3)); // CINT(0.0-255.0)
-            }
-        }
-    }
-    /*
-        "60%+60%=84%" formula
-        imagine a 60% opaque lens, you can see 40% of what's behind
-        now put another 60% opaque lens on top of it
-        you can now see 40% of the previous lens of which 40% is of the original scene
-        40% of 40% is 16%
-        100%-16%=84%
-        V1=60, V2=60
-        v1=V1/100, v2=V2/100
-        iv1=1-v1, iv2=1-v2
-        iv3=iv1*iv2
-        v3=1-iv3
-        V3=v3*100
-    */
-    ablend = (uint8 *)malloc(65536);
-    cp = ablend;
-    for (i = 0; i < 256; i++) {        // first alpha value
-        for (i2 = 0; i2 < 256; i2++) { // second alpha value
-            f = i;
-            f2 = i2;
-            f /= 255.0;
-            f2 /= 255.0;
-            f = 1.0 - f;
-            f2 = 1.0 - f2;
-            f3 = f * f2;
-            z = qbr_float_to_long((1.0 - f3) * 255.0);
-            *cp++ = z;
-        }
-    }
-    ablend127 = ablend + (127 << 8);
-    ablend128 = ablend + (128 << 8);
-}
-
 uint32 display_page_index = 0;
 uint32 write_page_index = 0;
 uint32 read_page_index = 0;
@@ -3651,9 +3625,7 @@ void restorepalette(img_struct *im) {
 } // restorepalette
 
 void pset(int32 x, int32 y, uint32 col) {
-    static uint8 *cp;
     static uint32 *o32;
-    static uint32 destcol;
     if (write_page->bytes_per_pixel == 1) {
         write_page->offset[y * write_page->width + x] = col & write_page->mask;
         return;
@@ -3673,20 +3645,17 @@ void pset(int32 x, int32 y, uint32 col) {
         case 0x80000000: //~50% alpha (optimized)
 
             o32 = write_page->offset32 + (y * write_page->width + x);
-            *o32 = (((*o32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*o32 >> 24] << 24);
+            *o32 = (((*o32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*o32 >> 24, 128) << 24);
             return;
             break;
         case 0x7F000000: //~50% alpha (optimized)
             o32 = write_page->offset32 + (y * write_page->width + x);
-            *o32 = (((*o32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*o32 >> 24] << 24);
+            *o32 = (((*o32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*o32 >> 24, 127) << 24);
             return;
             break;
-        default: // other alpha values (uses a lookup table)
+        default: // other alpha values (integer blend)
             o32 = write_page->offset32 + (y * write_page->width + x);
-            destcol = *o32;
-            cp = cblend + (col >> 24 << 16);
-            *o32 = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                   (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+            *o32 = image_blend_bgra(*o32, col);
         };
     }
 }
@@ -4013,8 +3982,6 @@ int32 imgnew(int32 x, int32 y, int32 bpp) {
     im = &img[i];
     if (bpp) { // graphics
         if (bpp == 32) {
-            if (!cblend)
-                init_blend();
             im->offset = (uint8 *)calloc(x * y, 4);
             if (!im->offset) {
                 sub__freeimage(-i, 1);
@@ -4122,7 +4089,7 @@ void sub__putimage(double f_dx1, double f_dy1, double f_dx2, double f_dy2, int32
 
     static int32 w, h, sskip, dskip, x, y, xx, yy, z, x2, y2, dbpp, sbpp;
     static img_struct *s, *d;
-    static uint32 *soff32, *doff32, col, clearcol, destcol;
+    static uint32 *soff32, *doff32, col, clearcol;
     static uint8 *soff, *doff;
     static uint8 *cp;
     static int32 xdir, ydir, no_stretch, no_clip, no_reverse, flip, mirror;
@@ -5040,16 +5007,13 @@ put_32_stretch:
             case 0x0:
                 break;
             case 0x80000000:
-                *doff32 = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*doff32 >> 24] << 24);
+                *doff32 = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*doff32 >> 24, 128) << 24);
                 break;
             case 0x7F000000:
-                *doff32 = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*doff32 >> 24] << 24);
+                *doff32 = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*doff32 >> 24, 127) << 24);
                 break;
             default:
-                destcol = *doff32;
-                cp = cblend + (col >> 24 << 16);
-                *doff32 = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                          (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+                *doff32 = image_blend_bgra(*doff32, col);
             }; // switch
             //--------done plot pixel--------
             doff32 += xdir;
@@ -5410,44 +5374,20 @@ noflip:
 put_32:
     w = dx2 - dx1 + 1;
     doff32 = d->offset32 + (dy1 * dw + dx1);
-    dskip = dw - w;
     if (flip) {
         soff32 = s->offset32 + (sy2 * sw + sx1);
-        sskip = -w - sw;
+        sskip = -sw;
     } else {
         soff32 = s->offset32 + (sy1 * sw + sx1);
-        sskip = sw - w;
+        sskip = sw;
     }
     // plot rect
     h = dy2 - dy1 + 1;
-    do {
-        xx = w;
-        do {
-            //--------plot pixel--------
-            switch ((col = *soff32++) & 0xFF000000) {
-            case 0xFF000000:
-                *doff32++ = col;
-                break;
-            case 0x0:
-                doff32++;
-                break;
-            case 0x80000000:
-                *doff32++ = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*doff32 >> 24] << 24);
-                break;
-            case 0x7F000000:
-                *doff32++ = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*doff32 >> 24] << 24);
-                break;
-            default:
-                destcol = *doff32;
-                cp = cblend + (col >> 24 << 16);
-                *doff32++ = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                            (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
-            }; // switch
-            //--------done plot pixel--------
-        } while (--xx);
+    while (h--) {
+        image_blit_row_blend32(doff32, soff32, w);
         soff32 += sskip;
-        doff32 += dskip;
-    } while (--h);
+        doff32 += dw;
+    }
     return;
 
 put_32_noalpha:
@@ -5490,27 +5430,20 @@ put_8_clear:
     clearcol = s->transparent_color;
     w = dx2 - dx1 + 1;
     doff = d->offset + (dy1 * dw + dx1);
-    dskip = dw - w;
     if (flip) {
         soff = s->offset + (sy2 * sw + sx1);
-        sskip = -w - sw;
+        sskip = -sw;
     } else {
         soff = s->offset + (sy1 * sw + sx1);
-        sskip = sw - w;
+        sskip = sw;
     }
     // plot rect
     h = dy2 - dy1 + 1;
-    do {
-        xx = w;
-        do {
-            if ((col = *soff++) != clearcol) {
-                *doff = col;
-            }
-            doff++;
-        } while (--xx);
+    while (h--) {
+        image_blit_row_keyed8(doff, soff, w, clearcol);
         soff += sskip;
-        doff += dskip;
-    } while (--h);
+        doff += dw;
+    }
     return;
 
 put_8_32:
@@ -5590,16 +5523,13 @@ put_32_mirror:
                 doff32++;
                 break;
             case 0x80000000:
-                *doff32++ = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*doff32 >> 24] << 24);
+                *doff32++ = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*doff32 >> 24, 128) << 24);
                 break;
             case 0x7F000000:
-                *doff32++ = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*doff32 >> 24] << 24);
+                *doff32++ = (((*doff32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*doff32 >> 24, 127) << 24);
                 break;
             default:
-                destcol = *doff32;
-                cp = cblend + (col >> 24 << 16);
-                *doff32++ = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                            (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+                *doff32++ = image_blend_bgra(*doff32, col);
             }; // switch
             //--------done plot pixel--------
         } while (--xx);
@@ -9413,9 +9343,7 @@ void pset_and_clip(int32 x, int32 y, uint32 col) {
 
     if ((x >= write_page->view_x1) && (x <= write_page->view_x2) && (y >= write_page->view_y1) && (y <= write_page->view_y2)) {
 
-        static uint8 *cp;
         static uint32 *o32;
-        static uint32 destcol;
         if (write_page->bytes_per_pixel == 1) {
             write_page->offset[y * write_page->width + x] = col & write_page->mask;
             return;
@@ -9435,20 +9363,17 @@ void pset_and_clip(int32 x, int32 y, uint32 col) {
                 break;
             case 0x80000000: //~50% alpha (optimized)
                 o32 = write_page->offset32 + (y * write_page->width + x);
-                *o32 = (((*o32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*o32 >> 24] << 24);
+                *o32 = (((*o32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*o32 >> 24, 128) << 24);
                 return;
                 break;
             case 0x7F000000: //~50% alpha (optimized)
                 o32 = write_page->offset32 + (y * write_page->width + x);
-                *o32 = (((*o32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*o32 >> 24] << 24);
+                *o32 = (((*o32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*o32 >> 24, 127) << 24);
                 return;
                 break;
-            default: // other alpha values (uses a lookup table)
+            default: // other alpha values (integer blend)
                 o32 = write_page->offset32 + (y * write_page->width + x);
-                destcol = *o32;
-                cp = cblend + (col >> 24 << 16);
-                *o32 = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                       (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+                *o32 = image_blend_bgra(*o32, col);
             };
         }
 
@@ -9457,10 +9382,10 @@ void pset_and_clip(int32 x, int32 y, uint32 col) {
 }
 
 void qb32_boxfill(float x1f, float y1f, float x2f, float y2f, uint32 col) {
-    static int32 x1, y1, x2, y2, i, width, img_width, x, y, d_width, a, a2, v1, v2, v3;
-    static uint8 *p, *cp, *cp2, *cp3;
+    static int32 x1, y1, x2, y2, i, width, img_width, x, y, d_width, a, v1, v2, v3;
+    static uint8 *p;
     static uint32 *lp, *lp_last, *lp_first;
-    static uint32 *doff32, destcol;
+    static uint32 *doff32;
 
     // resolve coordinates
     if (write_page->clipping_or_scaling) {
@@ -9573,7 +9498,7 @@ void qb32_boxfill(float x1f, float y1f, float x2f, float y2f, uint32 col) {
         while (y--) {
             x = width;
             while (x--) {
-                *doff32++ = (((*doff32 & 0xFEFEFE) + col) >> 1) + (ablend128[*doff32 >> 24] << 24);
+                *doff32++ = (((*doff32 & 0xFEFEFE) + col) >> 1) + (image_blend_alpha(*doff32 >> 24, 128) << 24);
             }
             doff32 += d_width;
         }
@@ -9585,26 +9510,17 @@ void qb32_boxfill(float x1f, float y1f, float x2f, float y2f, uint32 col) {
         while (y--) {
             x = width;
             while (x--) {
-                *doff32++ = (((*doff32 & 0xFEFEFE) + col) >> 1) + (ablend127[*doff32 >> 24] << 24);
+                *doff32++ = (((*doff32 & 0xFEFEFE) + col) >> 1) + (image_blend_alpha(*doff32 >> 24, 127) << 24);
             }
             doff32 += d_width;
         }
         return;
     }
     // ranged alpha
-    cp = cblend + (a << 16);
-    a2 = a << 8;
-    cp3 = cp + (col >> 8 & 0xFF00);
-    cp2 = cp + (col & 0xFF00);
-    cp += (col << 8 & 0xFF00);
     y = y2 - y1 + 1;
     while (y--) {
-        x = width;
-        while (x--) {
-            destcol = *doff32;
-            *doff32++ = cp[destcol & 255] + (cp2[destcol >> 8 & 255] << 8) + (cp3[destcol >> 16 & 255] << 16) + (ablend[(destcol >> 24) + a2] << 24);
-        }
-        doff32 += d_width;
+        image_blend_bgra_span(doff32, width, col);
+        doff32 += img_width;
     }
     return;
 }
@@ -9614,10 +9530,10 @@ void fast_boxfill(int32 x1, int32 y1, int32 x2, int32 y2, uint32 col) {
     // actual coordinates passed
     // left->right, top->bottom order
     // on-screen
-    static int32 i, width, img_width, x, y, d_width, a, a2, v1, v2, v3;
-    static uint8 *p, *cp, *cp2, *cp3;
+    static int32 i, width, img_width, x, y, d_width, a, v1, v2, v3;
+    static uint8 *p;
     static uint32 *lp, *lp_last, *lp_first;
-    static uint32 *doff32, destcol;
+    static uint32 *doff32;
 
     if (write_page->bytes_per_pixel == 1) {
         col &= write_page->mask;
@@ -9671,7 +9587,7 @@ void fast_boxfill(int32 x1, int32 y1, int32 x2, int32 y2, uint32 col) {
         while (y--) {
             x = width;
             while (x--) {
-                *doff32++ = (((*doff32 & 0xFEFEFE) + col) >> 1) + (ablend128[*doff32 >> 24] << 24);
+                *doff32++ = (((*doff32 & 0xFEFEFE) + col) >> 1) + (image_blend_alpha(*doff32 >> 24, 128) << 24);
             }
             doff32 += d_width;
         }
@@ -9683,26 +9599,17 @@ void fast_boxfill(int32 x1, int32 y1, int32 x2, int32 y2, uint32 col) {
         while (y--) {
             x = width;
             while (x--) {
-                *doff32++ = (((*doff32 & 0xFEFEFE) + col) >> 1) + (ablend127[*doff32 >> 24] << 24);
+                *doff32++ = (((*doff32 & 0xFEFEFE) + col) >> 1) + (image_blend_alpha(*doff32 >> 24, 127) << 24);
             }
             doff32 += d_width;
         }
         return;
     }
     // ranged alpha
-    cp = cblend + (a << 16);
-    a2 = a << 8;
-    cp3 = cp + (col >> 8 & 0xFF00);
-    cp2 = cp + (col & 0xFF00);
-    cp += (col << 8 & 0xFF00);
     y = y2 - y1 + 1;
     while (y--) {
-        x = width;
-        while (x--) {
-            destcol = *doff32;
-            *doff32++ = cp[destcol & 255] + (cp2[destcol >> 8 & 255] << 8) + (cp3[destcol >> 16 & 255] << 16) + (ablend[(destcol >> 24) + a2] << 24);
-        }
-        doff32 += d_width;
+        image_blend_bgra_span(doff32, width, col);
+        doff32 += img_width;
     }
     return;
 }
@@ -9941,27 +9848,82 @@ void sub_line(float x1, float y1, float x2, float y2, uint32 col, int32 bf, uint
 // simple comparisons are used, the alpha value is part of that comparison in all cases
 // even if blending is disabled (a fixed color is likely to have a fixed alpha value anyway),
 // and this allows for filling alpha regions
+// all of them (and the textured fill) share the span based flood fill below
+
+// Scanline flood fill used by all PAINT routines
+// Instead of queuing individual pixels, each seed is grown into the widest horizontal run (span) it belongs to, the span is filled in one go and
+// only one new seed per run of fillable pixels directly above and below it is pushed. Coordinates are int32 and the seed stack grows on demand, so
+// any image size is supported.
+// inside(offset) returns true if an unfilled pixel belongs to the region (it is never called for pixels that were already filled)
+// plot(offset, x, y, count) fills count pixels starting at offset (which is at x, y)
+struct paint_span_seed {
+    int32 x, y;
+};
+
+template <typename InsideFn, typename PlotFn>
+static void paint_span_fill(int32 ix, int32 iy, int32 width, int32 height, int32 view_x1, int32 view_y1, int32 view_x2, int32 view_y2, InsideFn &&inside,
+                            PlotFn &&plot) {
+    static std::vector<uint8> done; // pixels filled by the current call; only the filled spans are cleared afterwards
+    static std::vector<paint_span_seed> seeds;
+    static std::vector<paint_span_seed> spans; // x=first pixel offset, y=pixel count of every filled span (used for cleanup)
+
+    if (done.size() < size_t(width) * size_t(height))
+        done.resize(size_t(width) * size_t(height));
+
+    auto fillable = [&](int32 offset) { return !done[offset] && inside(offset); };
+
+    seeds.clear();
+    spans.clear();
+    seeds.push_back({ix, iy});
+
+    while (!seeds.empty()) {
+        auto seed = seeds.back();
+        seeds.pop_back();
+
+        auto row = seed.y * width;
+        if (!fillable(row + seed.x))
+            continue; // already filled via another seed
+
+        // grow the seed into a span
+        auto x1 = seed.x;
+        while (x1 > view_x1 && fillable(row + x1 - 1))
+            x1--;
+        auto x2 = seed.x;
+        while (x2 < view_x2 && fillable(row + x2 + 1))
+            x2++;
+
+        auto count = x2 - x1 + 1;
+        memset(&done[row + x1], 1, count);
+        plot(row + x1, x1, seed.y, count);
+        spans.push_back({row + x1, count});
+
+        // seed every run of fillable pixels in the rows above and below the span
+        for (auto y = seed.y - 1; y <= seed.y + 1; y += 2) {
+            if (y < view_y1 || y > view_y2)
+                continue;
+
+            auto row2 = y * width;
+            auto x = x1;
+            while (x <= x2) {
+                if (fillable(row2 + x)) {
+                    seeds.push_back({x, y});
+                    while (x <= x2 && fillable(row2 + x))
+                        x++;
+                } else {
+                    x++;
+                }
+            }
+        }
+    }
+
+    // cleanup
+    for (auto &span : spans)
+        memset(&done[span.x], 0, span.y);
+}
 
 // 32-bit WITH BENDING
 void sub_paint32(float x, float y, uint32 fillcol, uint32 bordercol, int32 passed) {
-
-    // uses 2 buffers, a and b, and swaps between them for reading and creating
-    static uint32 a_n = 0;
-    static uint16 *a_x = (uint16 *)malloc(2 * 65536), *a_y = (uint16 *)malloc(2 * 65536);
-    static uint8 *a_t = (uint8 *)malloc(65536);
-    static uint32 b_n = 0;
-    static uint16 *b_x = (uint16 *)malloc(2 * 65536), *b_y = (uint16 *)malloc(2 * 65536);
-    static uint8 *b_t = (uint8 *)malloc(65536);
-    static uint8 *done = (uint8 *)calloc(640 * 480, 1);
-    static int32 ix, iy, i, t, x2, y2;
-    static uint32 offset;
-    static uint8 *cp;
-    static uint16 *sp;
-    // overrides
-    static int32 done_size = 640 * 480;
-    static uint32 *qbg_active_page_offset;                                      // override
-    static int32 qbg_width, qbg_view_x1, qbg_view_y1, qbg_view_x2, qbg_view_y2; // override
-    static uint32 *doff32, destcol;
+    int32 ix, iy;
 
     if ((passed & 2) == 0)
         fillcol = write_page->color;
@@ -9995,269 +9957,39 @@ void sub_paint32(float x, float y, uint32 fillcol, uint32 bordercol, int32 passe
         return;
     }
 
-    // overrides
-    qbg_active_page_offset = write_page->offset32;
-    qbg_width = write_page->width;
-    qbg_view_x1 = write_page->view_x1;
-    qbg_view_y1 = write_page->view_y1;
-    qbg_view_x2 = write_page->view_x2;
-    qbg_view_y2 = write_page->view_y2;
-    i = write_page->width * write_page->height;
-    if (i > done_size) {
-        free(done);
-        done = (uint8 *)calloc(i, 1);
-    }
-
-    // return if first point is the bordercolor
-    if (qbg_active_page_offset[iy * qbg_width + ix] == bordercol)
-        return;
-
-    // create first node
-    a_x[0] = ix;
-    a_y[0] = iy;
-    a_t[0] = 15;
-    // types:
-    //&1=check left
-    //&2=check right
-    //&4=check above
-    //&8=check below
-
-    a_n = 1;
-    // qbg_active_page_offset[iy*qbg_width+ix]=fillcol;
-    offset = iy * qbg_width + ix;
-    //--------plot pixel--------
-    doff32 = qbg_active_page_offset + offset;
-    switch (fillcol & 0xFF000000) {
-    case 0xFF000000:
-        *doff32 = fillcol;
-        break;
-    case 0x0:
-        // doff32;
-        break;
-    case 0x80000000:
-        *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend128[*doff32 >> 24] << 24);
-        break;
-    case 0x7F000000:
-        *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend127[*doff32 >> 24] << 24);
-        break;
-    default:
-        destcol = *doff32;
-        cp = cblend + (fillcol >> 24 << 16);
-        *doff32 = cp[(fillcol << 8 & 0xFF00) + (destcol & 255)] + (cp[(fillcol & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                  (cp[(fillcol >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(fillcol >> 24) + (destcol >> 16 & 0xFF00)] << 24);
-    }; // switch
-    //--------done plot pixel--------
-    done[iy * qbg_width + ix] = 1;
-
-nextpass:
-    b_n = 0;
-    for (i = 0; i < a_n; i++) {
-        t = a_t[i];
-        ix = a_x[i];
-        iy = a_y[i];
-
-        // left
-        if (t & 1) {
-            x2 = ix - 1;
-            y2 = iy;
-            if (x2 >= qbg_view_x1) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        //--------plot pixel--------
-                        doff32 = qbg_active_page_offset + offset;
-                        switch (fillcol & 0xFF000000) {
-                        case 0xFF000000:
-                            *doff32 = fillcol;
-                            break;
-                        case 0x0:
-                            // doff32;
-                            break;
-                        case 0x80000000:
-                            *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend128[*doff32 >> 24] << 24);
-                            break;
-                        case 0x7F000000:
-                            *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend127[*doff32 >> 24] << 24);
-                            break;
-                        default:
-                            destcol = *doff32;
-                            cp = cblend + (fillcol >> 24 << 16);
-                            *doff32 = cp[(fillcol << 8 & 0xFF00) + (destcol & 255)] + (cp[(fillcol & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                      (cp[(fillcol >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(fillcol >> 24) + (destcol >> 16 & 0xFF00)] << 24);
-                        }; // switch
-                        //--------done plot pixel--------
-                        b_t[b_n] = 13;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-        // right
-        if (t & 2) {
-            x2 = ix + 1;
-            y2 = iy;
-            if (x2 <= qbg_view_x2) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        //--------plot pixel--------
-                        doff32 = qbg_active_page_offset + offset;
-                        switch (fillcol & 0xFF000000) {
-                        case 0xFF000000:
-                            *doff32 = fillcol;
-                            break;
-                        case 0x0:
-                            // doff32;
-                            break;
-                        case 0x80000000:
-                            *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend128[*doff32 >> 24] << 24);
-                            break;
-                        case 0x7F000000:
-                            *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend127[*doff32 >> 24] << 24);
-                            break;
-                        default:
-                            destcol = *doff32;
-                            cp = cblend + (fillcol >> 24 << 16);
-                            *doff32 = cp[(fillcol << 8 & 0xFF00) + (destcol & 255)] + (cp[(fillcol & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                      (cp[(fillcol >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(fillcol >> 24) + (destcol >> 16 & 0xFF00)] << 24);
-                        }; // switch
-                        //--------done plot pixel--------
-                        b_t[b_n] = 14;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-        // above
-        if (t & 4) {
-            x2 = ix;
-            y2 = iy - 1;
-            if (y2 >= qbg_view_y1) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        //--------plot pixel--------
-                        doff32 = qbg_active_page_offset + offset;
-                        switch (fillcol & 0xFF000000) {
-                        case 0xFF000000:
-                            *doff32 = fillcol;
-                            break;
-                        case 0x0:
-                            // doff32;
-                            break;
-                        case 0x80000000:
-                            *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend128[*doff32 >> 24] << 24);
-                            break;
-                        case 0x7F000000:
-                            *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend127[*doff32 >> 24] << 24);
-                            break;
-                        default:
-                            destcol = *doff32;
-                            cp = cblend + (fillcol >> 24 << 16);
-                            *doff32 = cp[(fillcol << 8 & 0xFF00) + (destcol & 255)] + (cp[(fillcol & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                      (cp[(fillcol >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(fillcol >> 24) + (destcol >> 16 & 0xFF00)] << 24);
-                        }; // switch
-                        //--------done plot pixel--------
-                        b_t[b_n] = 7;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-        // below
-        if (t & 8) {
-            x2 = ix;
-            y2 = iy + 1;
-            if (y2 <= qbg_view_y2) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        //--------plot pixel--------
-                        doff32 = qbg_active_page_offset + offset;
-                        switch (fillcol & 0xFF000000) {
-                        case 0xFF000000:
-                            *doff32 = fillcol;
-                            break;
-                        case 0x0:
-                            // doff32;
-                            break;
-                        case 0x80000000:
-                            *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend128[*doff32 >> 24] << 24);
-                            break;
-                        case 0x7F000000:
-                            *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (ablend127[*doff32 >> 24] << 24);
-                            break;
-                        default:
-                            destcol = *doff32;
-                            cp = cblend + (fillcol >> 24 << 16);
-                            *doff32 = cp[(fillcol << 8 & 0xFF00) + (destcol & 255)] + (cp[(fillcol & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                      (cp[(fillcol >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(fillcol >> 24) + (destcol >> 16 & 0xFF00)] << 24);
-                        }; // switch
-                        //--------done plot pixel--------
-                        b_t[b_n] = 11;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-    } // i
-
-    // no new nodes?
-    if (b_n == 0) {
-        memset(done, 0, write_page->width * write_page->height); // cleanup
-        return;                                                  // finished!
-    }
+    auto page = write_page->offset32;
 
-    // swap a & b arrays
-    sp = a_x;
-    a_x = b_x;
-    b_x = sp;
-    sp = a_y;
-    a_y = b_y;
-    b_y = sp;
-    cp = a_t;
-    a_t = b_t;
-    b_t = cp;
-    a_n = b_n;
+    paint_span_fill(
+        ix, iy, write_page->width, write_page->height, write_page->view_x1, write_page->view_y1, write_page->view_x2, write_page->view_y2,
+        [page, bordercol](int32 offset) { return page[offset] != bordercol; },
+        [page, fillcol](int32 offset, int32, int32, int32 count) {
+            auto doff32 = page + offset;
+            auto dend = doff32 + count;
 
-    goto nextpass;
+            switch (fillcol & 0xFF000000) {
+            case 0xFF000000:
+                std::fill(doff32, dend, fillcol);
+                break;
+            case 0x0:
+                // doff32;
+                break;
+            case 0x80000000:
+                for (; doff32 < dend; doff32++)
+                    *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (image_blend_alpha(*doff32 >> 24, 128) << 24);
+                break;
+            case 0x7F000000:
+                for (; doff32 < dend; doff32++)
+                    *doff32 = (((*doff32 & 0xFEFEFE) + (fillcol & 0xFEFEFE)) >> 1) + (image_blend_alpha(*doff32 >> 24, 127) << 24);
+                break;
+            default:
+                image_blend_bgra_span(doff32, count, fillcol);
+            }; // switch
+        });
 }
 
 // 32-bit NO ALPHA BENDING
 void sub_paint32x(float x, float y, uint32 fillcol, uint32 bordercol, int32 passed) {
-
-    // uses 2 buffers, a and b, and swaps between them for reading and creating
-    static uint32 a_n = 0;
-    static uint16 *a_x = (uint16 *)malloc(2 * 65536), *a_y = (uint16 *)malloc(2 * 65536);
-    static uint8 *a_t = (uint8 *)malloc(65536);
-    static uint32 b_n = 0;
-    static uint16 *b_x = (uint16 *)malloc(2 * 65536), *b_y = (uint16 *)malloc(2 * 65536);
-    static uint8 *b_t = (uint8 *)malloc(65536);
-    static uint8 *done = (uint8 *)calloc(640 * 480, 1);
-    static int32 ix, iy, i, t, x2, y2;
-    static uint32 offset;
-    static uint8 *cp;
-    static uint16 *sp;
-    // overrides
-    static int32 done_size = 640 * 480;
-    static uint32 *qbg_active_page_offset;                                      // override
-    static int32 qbg_width, qbg_view_x1, qbg_view_y1, qbg_view_x2, qbg_view_y2; // override
+    int32 ix, iy;
 
     if ((passed & 2) == 0)
         fillcol = write_page->color;
@@ -10291,141 +10023,12 @@ void sub_paint32x(float x, float y, uint32 fillcol, uint32 bordercol, int32 pass
         return;
     }
 
-    // overrides
-    qbg_active_page_offset = write_page->offset32;
-    qbg_width = write_page->width;
-    qbg_view_x1 = write_page->view_x1;
-    qbg_view_y1 = write_page->view_y1;
-    qbg_view_x2 = write_page->view_x2;
-    qbg_view_y2 = write_page->view_y2;
-    i = write_page->width * write_page->height;
-    if (i > done_size) {
-        free(done);
-        done = (uint8 *)calloc(i, 1);
-    }
-
-    // return if first point is the bordercolor
-    if (qbg_active_page_offset[iy * qbg_width + ix] == bordercol)
-        return;
-
-    // create first node
-    a_x[0] = ix;
-    a_y[0] = iy;
-    a_t[0] = 15;
-    // types:
-    //&1=check left
-    //&2=check right
-    //&4=check above
-    //&8=check below
-
-    a_n = 1;
-    qbg_active_page_offset[iy * qbg_width + ix] = fillcol;
-    done[iy * qbg_width + ix] = 1;
-
-nextpass:
-    b_n = 0;
-    for (i = 0; i < a_n; i++) {
-        t = a_t[i];
-        ix = a_x[i];
-        iy = a_y[i];
-
-        // left
-        if (t & 1) {
-            x2 = ix - 1;
-            y2 = iy;
-            if (x2 >= qbg_view_x1) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        qbg_active_page_offset[offset] = fillcol;
-                        b_t[b_n] = 13;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-        // right
-        if (t & 2) {
-            x2 = ix + 1;
-            y2 = iy;
-            if (x2 <= qbg_view_x2) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        qbg_active_page_offset[offset] = fillcol;
-                        b_t[b_n] = 14;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-        // above
-        if (t & 4) {
-            x2 = ix;
-            y2 = iy - 1;
-            if (y2 >= qbg_view_y1) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        qbg_active_page_offset[offset] = fillcol;
-                        b_t[b_n] = 7;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-        // below
-        if (t & 8) {
-            x2 = ix;
-            y2 = iy + 1;
-            if (y2 <= qbg_view_y2) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        qbg_active_page_offset[offset] = fillcol;
-                        b_t[b_n] = 11;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-    } // i
-
-    // no new nodes?
-    if (b_n == 0) {
-        memset(done, 0, write_page->width * write_page->height); // cleanup
-        return;                                                  // finished!
-    }
-
-    // swap a & b arrays
-    sp = a_x;
-    a_x = b_x;
-    b_x = sp;
-    sp = a_y;
-    a_y = b_y;
-    b_y = sp;
-    cp = a_t;
-    a_t = b_t;
-    b_t = cp;
-    a_n = b_n;
+    auto page = write_page->offset32;
 
-    goto nextpass;
+    paint_span_fill(
+        ix, iy, write_page->width, write_page->height, write_page->view_x1, write_page->view_y1, write_page->view_x2, write_page->view_y2,
+        [page, bordercol](int32 offset) { return page[offset] != bordercol; },
+        [page, fillcol](int32 offset, int32, int32, int32 count) { std::fill(page + offset, page + offset + count, fillcol); });
 }
 
 // 8-bit (default entry point)
@@ -10451,22 +10054,7 @@ void sub_paint(float x, float y, uint32 fillcol, uint32 bordercol, qbs *backgrou
         }
     }
 
-    // uses 2 buffers, a and b, and swaps between them for reading and creating
-    static uint32 a_n = 0;
-    static uint16 *a_x = (uint16 *)malloc(2 * 65536), *a_y = (uint16 *)malloc(2 * 65536);
-    static uint8 *a_t = (uint8 *)malloc(65536);
-    static uint32 b_n = 0;
-    static uint16 *b_x = (uint16 *)malloc(2 * 65536), *b_y = (uint16 *)malloc(2 * 65536);
-    static uint8 *b_t = (uint8 *)malloc(65536);
-    static uint8 *done = (uint8 *)calloc(640 * 480, 1);
-    static int32 ix, iy, i, t, x2, y2;
-    static uint32 offset;
-    static uint8 *cp;
-    static uint16 *sp;
-    // overrides
-    static int32 done_size = 640 * 480;
-    static uint8 *qbg_active_page_offset;                                       // override
-    static int32 qbg_width, qbg_view_x1, qbg_view_y1, qbg_view_x2, qbg_view_y2; // override
+    int32 ix, iy;
 
     if ((passed & 2) == 0)
         fillcol = write_page->color;
@@ -10502,141 +10090,12 @@ void sub_paint(float x, float y, uint32 fillcol, uint32 bordercol, qbs *backgrou
         return;
     }
 
-    // overrides
-    qbg_active_page_offset = write_page->offset;
-    qbg_width = write_page->width;
-    qbg_view_x1 = write_page->view_x1;
-    qbg_view_y1 = write_page->view_y1;
-    qbg_view_x2 = write_page->view_x2;
-    qbg_view_y2 = write_page->view_y2;
-    i = write_page->width * write_page->height;
-    if (i > done_size) {
-        free(done);
-        done = (uint8 *)calloc(i, 1);
-    }
-
-    // return if first point is the bordercolor
-    if (qbg_active_page_offset[iy * qbg_width + ix] == bordercol)
-        return;
-
-    // create first node
-    a_x[0] = ix;
-    a_y[0] = iy;
-    a_t[0] = 15;
-    // types:
-    //&1=check left
-    //&2=check right
-    //&4=check above
-    //&8=check below
-
-    a_n = 1;
-    qbg_active_page_offset[iy * qbg_width + ix] = fillcol;
-    done[iy * qbg_width + ix] = 1;
-
-nextpass:
-    b_n = 0;
-    for (i = 0; i < a_n; i++) {
-        t = a_t[i];
-        ix = a_x[i];
-        iy = a_y[i];
-
-        // left
-        if (t & 1) {
-            x2 = ix - 1;
-            y2 = iy;
-            if (x2 >= qbg_view_x1) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        qbg_active_page_offset[offset] = fillcol;
-                        b_t[b_n] = 13;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-        // right
-        if (t & 2) {
-            x2 = ix + 1;
-            y2 = iy;
-            if (x2 <= qbg_view_x2) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        qbg_active_page_offset[offset] = fillcol;
-                        b_t[b_n] = 14;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-        // above
-        if (t & 4) {
-            x2 = ix;
-            y2 = iy - 1;
-            if (y2 >= qbg_view_y1) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        qbg_active_page_offset[offset] = fillcol;
-                        b_t[b_n] = 7;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-        // below
-        if (t & 8) {
-            x2 = ix;
-            y2 = iy + 1;
-            if (y2 <= qbg_view_y2) {
-                offset = y2 * qbg_width + x2;
-                if (!done[offset]) {
-                    done[offset] = 1;
-                    if (qbg_active_page_offset[offset] != bordercol) {
-                        qbg_active_page_offset[offset] = fillcol;
-                        b_t[b_n] = 11;
-                        b_x[b_n] = x2;
-                        b_y[b_n] = y2;
-                        b_n++; // add new node
-                    }
-                }
-            }
-        }
-
-    } // i
-
-    // no new nodes?
-    if (b_n == 0) {
-        memset(done, 0, write_page->width * write_page->height); // cleanup
-        return;                                                  // finished!
-    }
-
-    // swap a & b arrays
-    sp = a_x;
-    a_x = b_x;
-    b_x = sp;
-    sp = a_y;
-    a_y = b_y;
-    b_y = sp;
-    cp = a_t;
-    a_t = b_t;
-    b_t = cp;
-    a_n = b_n;
+    auto page = write_page->offset;
 
-    goto nextpass;
+    paint_span_fill(
+        ix, iy, write_page->width, write_page->height, write_page->view_x1, write_page->view_y1, write_page->view_x2, write_page->view_y2,
+        [page, bordercol](int32 offset) { return page[offset] != bordercol; },
+        [page, fillcol](int32 offset, int32, int32, int32 count) { memset(page + offset, fillcol, count); });
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -10698,19 +10157,7 @@ void sub_paint(float x, float y, qbs *fillstr, uint32 bordercol, qbs *background
     if (is_error_pending())
         return;
 
-    // uses 2 buffers, a and b, and swaps between them for reading and creating
-    static uint32 a_n = 0;
-    static uint16 *a_x = (uint16 *)malloc(2 * 65536), *a_y = (uint16 *)malloc(2 * 65536);
-    static uint8 *a_t = (uint8 *)malloc(65536);
-    static uint32 b_n = 0;
-    static uint16 *b_x = (uint16 *)malloc(2 * 65536), *b_y = (uint16 *)malloc(2 * 65536);
-    static uint8 *b_t = (uint8 *)malloc(65536);
-    static uint8 *done = (uint8 *)calloc(640 * 480, 1);
-    static int32 ix, iy, i, t, x2, y2;
-    static uint32 offset;
-    static uint8 *cp;
-    static uint16 *sp;
-    static int32 done_size = 640 * 480;
+    int32 ix, iy;
 
     if (qbg_text_only) {
         error(5);
@@ -10786,111 +10233,25 @@ void sub_paint(float x, float y, qbs *fillstr, uint32 bordercol, qbs *background
         return;
     }
 
-    // overrides
-    qbg_active_page_offset = write_page->offset;
-    qbg_width = write_page->width;
-    qbg_view_x1 = write_page->view_x1;
-    qbg_view_y1 = write_page->view_y1;
-    qbg_view_x2 = write_page->view_x2;
-    qbg_view_y2 = write_page->view_y2;
-    i = write_page->width * write_page->height;
-    if (i > done_size) {
-        free(done);
-        done = (uint8 *)calloc(i, 1);
-    }
+    auto page = write_page->offset;
 
     // The original color of the starting location
-    uint32_t startingColor = qbg_active_page_offset[iy * qbg_width + ix];
+    uint32_t startingColor = page[iy * write_page->width + ix];
 
     bool borderColorProvided = passed & 4;
 
-    // Exit early if we're already at the border color
-    if (borderColorProvided && qbg_active_page_offset[iy * qbg_width + ix] == bordercol)
-        return;
-
-    // create first node
-    a_x[0] = ix;
-    a_y[0] = iy;
-    a_t[0] = 15;
-
-    a_n = 1;
-    qbg_active_page_offset[iy * qbg_width + ix] = tile[ix % sx][iy % sy];
-    done[iy * qbg_width + ix] = 1;
-
-    // Each index maps to a direction, in the order:
-    // Left, Right, Up, Down
-    int32_t xdelta[4] = {-1, 1, 0, 0};
-    int32_t ydelta[4] = {0, 0, -1, 1};
-
-    // The bits indicate the directions that should be checked for the next
-    // pixel, we ignore the direction we came from.
-    uint32_t dirCheckMap[4] = {
-        1 | 4 | 8, // Left, Up, Down
-        2 | 4 | 8, // Right, Up, Down
-        1 | 2 | 4, // Left, Right, Up
-        1 | 2 | 8, // Left, Right, Down
-    };
-
-    while (true) {
-        b_n = 0;
-        for (i = 0; i < a_n; i++) {
-            t = a_t[i];
-            ix = a_x[i];
-            iy = a_y[i];
-
-            for (int k = 0; k < 4; k++) {
-                if ((t & (1 << k)) == 0)
-                    continue;
-
-                x2 = ix + xdelta[k];
-                y2 = iy + ydelta[k];
-
-                // Verify dimensions are within bounds
-                if (x2 >= qbg_view_x1 && x2 <= qbg_view_x2 && y2 >= qbg_view_y1 && y2 <= qbg_view_y2) {
-                    offset = y2 * qbg_width + x2;
-
-                    // Check that we haven't done this pixel yet
-                    if (!done[offset]) {
-                        done[offset] = 1;
-
-                        // We either check that we didn't hit the border color
-                        // (if provided), or that we're still the starting
-                        // color.
-                        if ((borderColorProvided && qbg_active_page_offset[offset] != bordercol) ||
-                            (!borderColorProvided && qbg_active_page_offset[offset] == startingColor)) {
-
-                            qbg_active_page_offset[offset] = tile[x2 % sx][y2 % sy];
-                            b_t[b_n] = dirCheckMap[k];
-                            b_x[b_n] = x2;
-                            b_y[b_n] = y2;
-                            b_n++; // add new node
-                        }
-                    }
-                }
-            }
-        }
-
-        // no new nodes?
-        if (b_n == 0) {
-            memset(done, 0, write_page->width * write_page->height); // cleanup
-            return;                                                  // finished!
-        }
-
-        // swap a & b arrays
-        sp = a_x;
-        a_x = b_x;
-        b_x = sp;
-
-        sp = a_y;
-        a_y = b_y;
-        b_y = sp;
-
-        cp = a_t;
-        a_t = b_t;
-        b_t = cp;
-
-        a_n = b_n;
-    }
+    paint_span_fill(
+        ix, iy, write_page->width, write_page->height, write_page->view_x1, write_page->view_y1, write_page->view_x2, write_page->view_y2,
+        [page, bordercol, startingColor, borderColorProvided](int32 offset) {
+            // We either check that we didn't hit the border color
+            // (if provided), or that we're still the starting
+            // color.
+            return borderColorProvided ? page[offset] != bordercol : page[offset] == startingColor;
+        },
+        [page](int32 offset, int32 x, int32 y, int32 count) {
+            for (auto i = 0; i < count; i++)
+                page[offset + i] = tile[(x + i) % sx][y % sy];
+        });
 }
 
 void sub_circle(double x, double y, double r, uint32 col, double start, double end, double aspect, int32 passed) {
@@ -11536,11 +10897,53 @@ int32_t chrwidth(uint32_t character) {
     return w;
 }
 
-void newline() {
+// Scrolls the VIEW PRINT region of write_page up by 'lines' text rows and blanks the rows that come free
+static void scroll_print_region(int32 lines) {
     static uint32 *lp;
     static uint16 *sp;
-    static int32 z, z2;
+    static int32 z, z2, rows;
+    static size_t row_bytes;
+    static uint8 *top;
 
+    rows = write_page->bottom_row - write_page->top_row + 1;
+    if (lines > rows)
+        lines = rows;
+
+    if (write_page->text) {
+        // text
+        row_bytes = 2 * write_page->width;
+        top = write_page->offset + (write_page->top_row - 1) * row_bytes;
+        // move lines up
+        memmove(top, top + lines * row_bytes, (rows - lines) * row_bytes);
+        // erase bottom lines
+        z2 = (write_page->color & 0xF) + (write_page->background_color & 7) * 16 + (write_page->color & 16) * 8;
+        z2 <<= 8;
+        z2 += 32;
+        sp = (uint16 *)(top + (rows - lines) * row_bytes);
+        z = write_page->width * lines;
+        while (z--)
+            *sp++ = z2;
+    } else {
+        // graphics
+        row_bytes = write_page->bytes_per_pixel * write_page->width * fontheight[write_page->font];
+        top = write_page->offset + (write_page->top_row - 1) * row_bytes;
+        // move lines up
+        memmove(top, top + lines * row_bytes, (rows - lines) * row_bytes);
+        // erase bottom lines
+        if (write_page->bytes_per_pixel == 1) {
+            memset(top + (rows - lines) * row_bytes, write_page->background_color, lines * row_bytes);
+        } else {
+            // assume 32-bit
+            z2 = write_page->background_color;
+            lp = (uint32 *)(top + (rows - lines) * row_bytes);
+            z = write_page->width * fontheight[write_page->font] * lines;
+            while (z--)
+                *lp++ = z2;
+        }
+    } // graphics
+}
+
+void newline() {
     // move cursor to new line
     write_page->cursor_y++;
     write_page->cursor_x = 1;
@@ -11555,38 +10958,7 @@ void newline() {
             return;
         }
 
-        if (write_page->text) {
-            // text
-            // move lines up
-            memmove(write_page->offset + (write_page->top_row - 1) * 2 * write_page->width, write_page->offset + write_page->top_row * 2 * write_page->width,
-                    (write_page->bottom_row - write_page->top_row) * 2 * write_page->width);
-            // erase bottom line
-            z2 = (write_page->color & 0xF) + (write_page->background_color & 7) * 16 + (write_page->color & 16) * 8;
-            z2 <<= 8;
-            z2 += 32;
-            sp = ((uint16 *)(write_page->offset + (write_page->bottom_row - 1) * 2 * write_page->width));
-            z = write_page->width;
-            while (z--)
-                *sp++ = z2;
-        } else {
-            // graphics
-            // move lines up
-            memmove(write_page->offset + (write_page->top_row - 1) * write_page->bytes_per_pixel * write_page->width * fontheight[write_page->font],
-                    write_page->offset + write_page->top_row * write_page->bytes_per_pixel * write_page->width * fontheight[write_page->font],
-                    (write_page->bottom_row - write_page->top_row) * write_page->bytes_per_pixel * write_page->width * fontheight[write_page->font]);
-            // erase bottom line
-            if (write_page->bytes_per_pixel == 1) {
-                memset(write_page->offset + (write_page->bottom_row - 1) * write_page->width * fontheight[write_page->font], write_page->background_color,
-                       write_page->width * fontheight[write_page->font]);
-            } else {
-                // assume 32-bit
-                z2 = write_page->background_color;
-                lp = write_page->offset32 + (write_page->bottom_row - 1) * write_page->width * fontheight[write_page->font];
-                z = write_page->width * fontheight[write_page->font];
-                while (z--)
-                    *lp++ = z2;
-            }
-        } // graphics
+        scroll_print_region(1);
         write_page->cursor_y = write_page->bottom_row;
     } // scroll up
 
@@ -11745,6 +11117,30 @@ int32 func__controlchr() {
     return -no_control_characters2;
 }
 
+// Counts the line breaks in str from index i on, up to 'limit'. Counting stops at control characters which
+// move the cursor elsewhere, so every line break counted is certain to start a new line below the current one.
+static int32 print_line_breaks_ahead(qbs *str, int32 i, int32 limit) {
+    int32 n = 0, step = 1;
+    uint32 c;
+
+    if (fontflags[write_page->font] & FONT_LOAD_UNICODE)
+        step = 4;
+
+    for (; (i + step) <= str->len && n < limit; i += step) {
+        if (step == 4)
+            c = *((int32 *)(&str->chr[i]));
+        else
+            c = str->chr[i];
+
+        if ((c == 10) || (c == 13))
+            n++;
+        else if ((c == 11) || (c == 12) || ((c >= 28) && (c <= 31)))
+            break;
+    }
+
+    return n;
+}
+
 void qbs_print(qbs *str, int32 finish_on_new_line) {
     if (is_error_pending())
         return;
@@ -11757,11 +11153,10 @@ void qbs_print(qbs *str, int32 finish_on_new_line) {
             std::cout.write((char *)str->chr, str->len);
 
         if (finish_on_new_line)
-            std::cout << std::endl;
+            std::cout.put('\n');
 
-#ifndef QB64_WINDOWS
-        std::cout.flush();
-#endif
+        if (!console_output_buffered)
+            std::cout.flush();
 
         return;
     }
@@ -11967,7 +11362,15 @@ void qbs_print(qbs *str, int32 finish_on_new_line) {
         }
 
         if ((character == 10) || (character == 13)) {
-            newline();
+            if ((write_page->cursor_y == write_page->bottom_row) && (!lprint)) {
+                // scroll once for this and the line breaks already waiting in the string, rather than once per line
+                z = print_line_breaks_ahead(str, i + 1, write_page->bottom_row - write_page->top_row) + 1;
+                scroll_print_region(z);
+                write_page->cursor_y = write_page->bottom_row - z + 1;
+                write_page->cursor_x = 1;
+            } else {
+                newline();
+            }
             if (lprint)
                 lpos = 1;
             // note: entered_new_line not set because these carriage returns compound on each other
@@ -12917,6 +12320,7 @@ int32 cursor_show_last;
 void qbs_input(int32 numvariables, uint8 newline) {
     if (is_error_pending())
         return;
+    console_output_flush(); // the prompt, and whatever the user should see before answering
     int32 i, i2, i3, i4, i5, i6, chr;
 
     static int32 autodisplay_backup;
@@ -14373,7 +13777,17 @@ void sub_open(qbs *name, int32 type, int32 access, int32 sharing, int32 i, int64
             gfs_setpos(x, x64); // not an error and not null length
     }
 
+    // sequential files are buffered, as in QB the buffer size can be set using LEN =
+    static int64 buffer_size;
+    buffer_size = (passed && record_length != -1) ? record_length : 0;
+
+    if (f->type == 4 && !f->com_port) // COM port output is never held back
+        gfs_enable_write_buffer(x, buffer_size ? buffer_size : GFS_DEFAULT_WRITE_BUFFER_SIZE);
+
     if (type == 3) { // check if eof character, CHR$(26), is the first byte and set EOF accordingly
+        // COM ports must not block waiting for the read-ahead buffer to fill
+        gfs_enable_read_buffer(x, f->com_port ? 1 : (buffer_size ? buffer_size : GFS_DEFAULT_READ_BUFFER_SIZE));
+
         static int64 x64;
         x64 = gfs_lof(x);
         if (x64) {
@@ -16141,19 +15555,16 @@ void sub_get(int32 i, int64 offset, void *element, int32 passed) {
         case special_handle_type::Stream:
             st = (stream_struct *)sh->index;
 
-            stream_update(st);
             ele = (byte_element_struct *)element;
+            stream_update(st, ele->length);
             if (st->in_size < ele->length) {
                 st->eof = 1;
                 return;
             }
 
             st->eof = 0;
-            memcpy((void *)(ele->offset), st->in, ele->length);
-            x2 = st->in_size - ele->length;
-            if (x2)
-                memmove(st->in, st->in + ele->length, x2);
-            st->in_size -= ele->length;
+            memcpy((void *)(ele->offset), st->in + st->in_start, ele->length);
+            stream_consume(st, ele->length);
             break;
 
         case special_handle_type::Http:
@@ -16296,9 +15707,9 @@ void sub_get2(int32 i, int64 offset, qbs *str, int32 passed) {
 
             tqbs = qbs_new(st->in_size, 1);
             if (st->in_size)
-                memcpy(tqbs->chr, st->in, st->in_size);
+                memcpy(tqbs->chr, st->in + st->in_start, st->in_size);
 
-            st->in_size = 0;
+            stream_consume(st, st->in_size);
             st->eof = 0;
             qbs_set(str, tqbs);
             break;
@@ -17402,6 +16813,7 @@ int32 sleep_break = 0;
 void sub_sleep(int32 seconds, int32 passed) {
     if (is_error_pending())
         return;
+    console_output_flush();
 
     sleep_break = 0;
     double prev, ms, now, elapsed; // cannot be static
@@ -18205,6 +17617,30 @@ int32 func__statusCode(int32 handle) {
     return code;
 }
 
+int64 func__httpstats(qbs *statistic) {
+    // Returns one of the connection statistics of all HTTP requests made so far:
+    // "REQUESTS" finished requests, "CONNECTIONS" new connections made for them,
+    // "REUSED" successful requests that were sent over an already open (kept alive) connection
+    if (is_error_pending())
+        return 0;
+
+    std::string name((char *)statistic->chr, statistic->len);
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::toupper(c); });
+
+    struct libqb_http_stats stats;
+    libqb_http_get_stats(&stats);
+
+    if (name == "REQUESTS")
+        return stats.requests;
+    if (name == "CONNECTIONS")
+        return stats.connections;
+    if (name == "REUSED")
+        return stats.reused_connections;
+
+    error(5);
+    return 0;
+}
+
 void sub_seek(int32 i, int64 pos) {
     if (is_error_pending())
         return;
@@ -18249,6 +17685,35 @@ void sub_seek(int32 i, int64 pos) {
     }
 }
 
+void sub__flush(int32 i, int32 passed) {
+    if (is_error_pending())
+        return;
+    if (!passed) {
+        gfs_flush_all_files();
+        console_output_flush();
+        return;
+    }
+    if (gfs_fileno_valid(i) != 1) {
+        error(52);
+        return;
+    } // Bad file name or number
+    i = gfs_get_fileno(i); // convert fileno to gfs index
+    int32 e;
+    e = gfs_flush(i);
+    if (e < 0) {
+        if (e == -2) {
+            error(258);
+            return;
+        } // invalid handle
+        if (e == -7) {
+            error(70);
+            return;
+        } // permission denied
+        error(75);
+        return; // assume[-9]: path/file access error
+    }
+}
+
 int64 func_seek(int32 i) {
     if (gfs_fileno_valid(i) != 1) {
         error(52);
@@ -18411,6 +17876,7 @@ qbs *func_input(int32 n, int32 i, int32 passed) {
         }
         if (n == 0)
             return str;
+        console_output_flush(); // whatever the user should see before we wait for keys
         x = 0;
     waitforinput:
         str2 = qbs_inkey();
@@ -18431,53 +17897,79 @@ qbs *func_input(int32 n, int32 i, int32 passed) {
 }
 
 void file_line_input_string_character(int32 filehandle, qbs *deststr) {
-    static qbs *str, *character;
-    int32 c, nextc;
-    int32 inspeechmarks;
+    // scans the read-ahead buffer for the end of the line directly, so the string is only built once per buffer
+    static std::string line;
+    uint8 *data;
+    int64 size, n;
+    int32 c, e;
+    bool got_data = false;
 
-    str = qbs_new(0, 0);
-    c = file_input_chr(filehandle);
-    if (c == -2)
-        return;
-    if (c == -1) {
-        qbs_set(deststr, str);
-        qbs_free(str);
+    line.clear();
+
+    for (;;) {
+        e = gfs_read_peek(filehandle, &data, &size);
+        if (e) {
+            if (e == -10) {
+                c = -1; // eof
+                break;
+            }
+            if (e == -2) {
+                error(258);
+                return;
+            } // invalid handle
+            if (e == -3) {
+                error(54);
+                return;
+            } // bad file mode
+            if (e == -7) {
+                error(70);
+                return;
+            } // permission denied
+            error(75);
+            return; // assume[-9]: path/file access error
+        }
+
+        // find the first CR, LF or CHR$(26) (each search is limited to the part before the previous match)
+        n = size;
+        auto p = (uint8 *)memchr(data, 10, n);
+        if (p)
+            n = p - data;
+        p = (uint8 *)memchr(data, 13, n);
+        if (p)
+            n = p - data;
+        p = (uint8 *)memchr(data, 26, n);
+        if (p)
+            n = p - data;
+
+        if (n)
+            got_data = true;
+
+        line.append((char *)data, n);
+        gfs_read_skip(filehandle, n);
+
+        if (n < size) {
+            c = data[n];
+            if (c == 26) { // eof character (left in place so subsequent reads will re-encounter it)
+                gfs_get_file_struct(filehandle)->eof_passed = 1;
+                c = -1;
+            } else {
+                gfs_read_skip(filehandle, 1);
+                got_data = true;
+            }
+            break;
+        }
+    }
+
+    if (!got_data) {
+        qbs_set(deststr, qbs_new(0, 1));
         error(62); // input past end of file
         return;
     }
-    character = qbs_new(1, 0);
-nextchr:
-    if (c == -1)
-        goto gotstr;
-    if (c == 10)
-        goto gotstr;
-    if (c == 13)
-        goto gotstr;
-    character->chr[0] = c;
-    qbs_set(str, qbs_add(str, character));
-    c = file_input_chr(filehandle);
-    if (c == -2)
-        return;
-    goto nextchr;
-gotstr:
-nextstr:
-    // scan until next item (or eof) reached
-    if (c == -1)
-        goto returnstr;
-    if ((c == 10) || (c == 13)) { // lf cr
+
+    if ((c == 10) || (c == 13)) // lf cr
         file_input_skip1310(filehandle, c);
-        goto returnstr;
-    }
-    c = file_input_chr(filehandle);
-    if (c == -2)
-        return;
-    goto nextstr;
-// return string
-returnstr:
-    qbs_set(deststr, str);
-    qbs_free(str);
-    qbs_free(character);
-    return;
+
+    qbs_set(deststr, qbs_new_txt_len(line.c_str(), line.length()));
 }
 
 void file_line_input_string_binary(int32 fileno, qbs *deststr) {
@@ -20832,6 +20324,7 @@ void sub_end() {
     dont_call_sub_gl = 1;
 
     sub_close(NULL, 0);
+    console_output_flush();
     exit_blocked = 0; // allow exit via X-box or CTRL+BREAK
 
 #ifdef DEPENDENCY_CONSOLE_ONLY
@@ -22804,10 +22297,17 @@ udlr:
 #    include <winsock2.h>
 WSADATA wsaData;
 WORD sockVersion;
+typedef WSAPOLLFD tcp_pollfd;
+#    define tcp_poll WSAPoll
+#    define tcp_would_block() (WSAGetLastError() == WSAEWOULDBLOCK)
 #else
 #    include <netdb.h>
+#    include <poll.h>
 #    include <sys/socket.h>
 #    include <sys/types.h>
+typedef struct pollfd tcp_pollfd;
+#    define tcp_poll poll
+#    define tcp_would_block() (errno == EAGAIN || errno == EWOULDBLOCK)
 #endif
 
 #define NETWORK_ERROR -1
@@ -22844,6 +22344,12 @@ struct tcp_connection {
     uint8 ip4[4];    // connection to host only
     uint8 *hostname; // clients only
     int connected;
+
+    // Data the OS wasn't ready to accept yet, it is sent by tcp_flush() once the socket becomes writable again
+    uint8 *out;
+    ptrszint out_start; // unsent data starts at out + out_start
+    ptrszint out_size;  // bytes still to be sent
+    ptrszint out_limit; // allocated size of 'out'
 };
 
 void *tcp_host_open(int64 port) {
@@ -23070,8 +22576,55 @@ void *tcp_connection_open(void *host_tcp) {
 #endif
 }
 
+// Sends as much of the queued output as the OS will take without blocking
+void tcp_flush(tcp_connection *tcp) {
+#if !defined(DEPENDENCY_SOCKETS)
+#elif defined(QB64_WINDOWS) || defined(QB64_UNIX)
+// Handle Windows which might not have this flag (it would be a no-op anyway)
+#    if !defined(MSG_NOSIGNAL)
+#        define MSG_NOSIGNAL 0
+#    endif
+    int n;
+
+    while (tcp->out_size && tcp->connected) {
+        n = send(tcp->socket, (char *)(tcp->out + tcp->out_start), tcp->out_size, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (!tcp_would_block())
+                tcp->connected = 0; // fatal error
+            break;
+        }
+        tcp->out_start += n;
+        tcp->out_size -= n;
+    }
+
+    if (!tcp->out_size || !tcp->connected) {
+        tcp->out_start = 0;
+        tcp->out_size = 0;
+    }
+#endif
+}
+
 void tcp_close(void *connection) {
     tcp_connection *tcp = (tcp_connection *)connection;
+
+#if defined(DEPENDENCY_SOCKETS)
+    // give queued output a short grace period to drain before the socket goes away
+    if (tcp->out_size) {
+        int64_t deadline = GetTicks() + 1000;
+        tcp_pollfd pfd;
+
+        tcp_flush(tcp);
+        while (tcp->out_size && GetTicks() < deadline) {
+            pfd.fd = tcp->socket;
+            pfd.events = POLLOUT;
+            pfd.revents = 0;
+            if (tcp_poll(&pfd, 1, 10) < 0)
+                break;
+            tcp_flush(tcp);
+        }
+    }
+#endif
+
 #if !defined(DEPENDENCY_SOCKETS)
 #elif defined(QB64_WINDOWS)
     if (tcp->socket) {
@@ -23086,31 +22639,58 @@ void tcp_close(void *connection) {
 #endif
     if (tcp->hostname)
         free(tcp->hostname);
+    if (tcp->out)
+        free(tcp->out);
     free(tcp);
 }
 
 void tcp_out(void *connection, void *offset, ptrszint bytes) {
 #if !defined(DEPENDENCY_SOCKETS)
 #elif defined(QB64_WINDOWS) || defined(QB64_UNIX)
-// Handle Windows which might not have this flag (it would be a no-op anyway)
-#    if !defined(MSG_NOSIGNAL)
-#        define MSG_NOSIGNAL 0
-#    endif
     tcp_connection *tcp;
     tcp = (tcp_connection *)connection;
-    int total = 0;         // how many bytes we've sent
-    int bytesleft = bytes; // how many we have left to send
+    ptrszint total = 0; // how many bytes we've sent
     int n;
 
-    while (total < bytes) {
-        n = send(tcp->socket, (char *)((char *)offset + total), bytesleft, MSG_NOSIGNAL);
+    if (!tcp->connected)
+        return;
+
+    // anything already queued has to go first to keep the stream in order
+    tcp_flush(tcp);
+
+    while (!tcp->out_size && total < bytes) {
+        n = send(tcp->socket, (char *)((char *)offset + total), bytes - total, MSG_NOSIGNAL);
         if (n < 0) {
+            if (tcp_would_block())
+                break; // the OS send buffer is full, queue the rest
+
             tcp->connected = 0;
             return;
         }
         total += n;
-        bytesleft -= n;
     }
+
+    if (total == bytes)
+        return;
+
+    // queue whatever wasn't sent, tcp_flush() picks it up as the socket becomes writable
+    if (tcp->out_start + tcp->out_size + (bytes - total) > tcp->out_limit) {
+        if (tcp->out_start) {
+            memmove(tcp->out, tcp->out + tcp->out_start, tcp->out_size);
+            tcp->out_start = 0;
+        }
+
+        if (tcp->out_size + (bytes - total) > tcp->out_limit) {
+            if (!tcp->out_limit)
+                tcp->out_limit = 1024;
+            while (tcp->out_size + (bytes - total) > tcp->out_limit)
+                tcp->out_limit *= 2;
+            tcp->out = (uint8 *)realloc(tcp->out, tcp->out_limit);
+        }
+    }
+
+    memcpy(tcp->out + tcp->out_start + tcp->out_size, (char *)offset + total, bytes - total);
+    tcp->out_size += bytes - total;
 #else
 #endif
 }
@@ -23141,7 +22721,7 @@ void stream_out(stream_struct *st, void *offset, ptrszint bytes) {
     } // Network
 } // stream_out
 
-void stream_update(stream_struct *stream) {
+void stream_update(stream_struct *stream, ptrszint wanted) {
 #ifdef DEPENDENCY_SOCKETS
     // assume tcp
 
@@ -23151,22 +22731,39 @@ void stream_update(stream_struct *stream) {
     tcp = (tcp_connection *)(connection->connection);
     static ptrszint bytes;
 
+    if (tcp->out_size)
+        tcp_flush(tcp);
+
     if (!stream->in_limit) {
-        stream->in = (uint8 *)malloc(1024);
+        stream->in = (uint8 *)malloc(STREAM_IN_MIN_LIMIT);
+        stream->in_start = 0;
         stream->in_size = 0;
-        stream->in_limit = 1024;
+        stream->in_limit = STREAM_IN_MIN_LIMIT;
     }
 
 expand_and_retry:
 
-    // expand buffer if 'in' stream is full
+    // make room if the end of the 'in' buffer has been reached
     // also guarantees that bytes requested from recv() is not 0
-    if (stream->in_size == stream->in_limit) {
-        stream->in_limit *= 2;
-        stream->in = (uint8 *)realloc(stream->in, stream->in_limit);
+    if (stream->in_start + stream->in_size == stream->in_limit) {
+        if (stream->in_start >= stream->in_limit / 2) {
+            // reclaim the space in front of the read cursor once it is at least half the buffer, so every byte moved
+            // is paid for by a byte consumed and reading small pieces from a full buffer stays linear
+            memmove(stream->in, stream->in + stream->in_start, stream->in_size);
+            stream->in_start = 0;
+        } else if (stream->in_limit < STREAM_IN_MAX_LIMIT || stream->in_limit < wanted) {
+            stream->in_limit *= 2;
+            stream->in = (uint8 *)realloc(stream->in, stream->in_limit);
+        } else if (stream->in_start && stream->in_size < wanted) {
+            // the pending read fits the buffer, but only once the consumed data in front of it is gone
+            memmove(stream->in, stream->in + stream->in_start, stream->in_size);
+            stream->in_start = 0;
+        } else {
+            return; // leave the remaining data with the OS until the program catches up
+        }
     }
 
-    bytes = recv(tcp->socket, (char *)(stream->in + stream->in_size), stream->in_limit - stream->in_size, 0);
+    bytes = recv(tcp->socket, (char *)(stream->in + stream->in_start + stream->in_size), stream->in_limit - stream->in_start - stream->in_size, 0);
     if (bytes < 0) { // some kind of error
 #    ifdef QB64_WINDOWS
         if (WSAGetLastError() != WSAEWOULDBLOCK)
@@ -23179,7 +22776,7 @@ expand_and_retry:
         tcp->connected = 0;
     } else {
         stream->in_size += bytes;
-        if (stream->in_size == stream->in_limit)
+        if (stream->in_start + stream->in_size == stream->in_limit)
             goto expand_and_retry;
     }
 #endif
@@ -23378,6 +22975,7 @@ int32 connection_new(int32 method, qbs *info_in, int32 value) {
 
             // init stream
             my_stream_struct->in = NULL;
+            my_stream_struct->in_start = 0;
             my_stream_struct->in_size = 0;
             my_stream_struct->in_limit = 0;
 
@@ -23450,6 +23048,7 @@ int32 connection_new(int32 method, qbs *info_in, int32 value) {
 
         // init stream
         my_stream_struct->in = NULL;
+        my_stream_struct->in_start = 0;
         my_stream_struct->in_size = 0;
         my_stream_struct->in_limit = 0;
 
@@ -23658,6 +23257,165 @@ error:
     return 0;
 }
 
+#ifdef DEPENDENCY_SOCKETS
+// Checks a TCP handle for something the program can act on without waiting: unread data or a lost connection
+static bool connection_wait_ready(special_handle_struct *sh) {
+    if (sh->type != special_handle_type::Stream)
+        return false;
+
+    stream_struct *ss = (stream_struct *)sh->index;
+    connection_struct *cs = (connection_struct *)ss->index;
+    if (ss->type != stream_type::Tcp || cs->protocol != 1)
+        return false;
+
+    return ss->in_size || !tcp_connected(cs->connection);
+}
+
+// Adds a TCP handle to the poll() set, returns false if it isn't one we can wait on
+static bool connection_wait_add(special_handle_struct *sh, std::vector<tcp_pollfd> &fds) {
+    connection_struct *cs;
+    tcp_pollfd pfd;
+
+    switch (sh->type) {
+    case special_handle_type::Stream:
+        if (((stream_struct *)sh->index)->type != stream_type::Tcp)
+            return false;
+        cs = (connection_struct *)((stream_struct *)sh->index)->index;
+        break;
+
+    case special_handle_type::Host:
+        cs = (connection_struct *)sh->index;
+        break;
+
+    default:
+        return false;
+    }
+
+    if (cs->protocol != 1)
+        return false;
+
+    tcp_connection *tcp = (tcp_connection *)cs->connection;
+    pfd.fd = tcp->socket;
+    pfd.events = POLLIN;
+    if (tcp->out_size)
+        pfd.events |= POLLOUT;
+    pfd.revents = 0;
+    fds.push_back(pfd);
+
+    return true;
+}
+#endif
+
+int32 func__connectionwait(double timeout, int32 i, int32 passed) {
+    // Waits up to 'timeout' seconds (forever if negative) for a TCP handle to need attention: a client or
+    // host's connection with data to read or that has disconnected, or a host with a connection waiting to be
+    // accepted by _OPENCONNECTION. Only handle 'i' is watched if passed, otherwise all open TCP handles.
+    // Returns the handle or 0 if the time ran out. Queued output from PUT is sent while waiting.
+    if (is_error_pending())
+        return 0;
+
+#ifdef DEPENDENCY_SOCKETS
+    static std::vector<tcp_pollfd> fds;
+    static std::vector<int32> fd_handles;
+    static int32 last_handle = 0; // the search starts after the last handle returned, so busy handles can't starve the rest
+    special_handle_struct *sh;
+    int32 x, first, last, count;
+
+    if (passed) { // wait on just this handle
+        if (i >= 0) {
+            error(52);
+            return 0;
+        }
+
+        first = last = -(i + 1);
+        sh = (special_handle_struct *)list_get(special_handles, first);
+        if (!sh || (sh->type != special_handle_type::Stream && sh->type != special_handle_type::Host)) {
+            error(52);
+            return 0;
+        }
+    } else {
+        first = 1;
+        last = special_handles->indexes;
+    }
+
+    count = last - first + 1;
+    int64_t deadline = timeout < 0 ? -1 : GetTicks() + (int64_t)(timeout * 1000.0);
+
+    while (true) {
+        fds.clear();
+        fd_handles.clear();
+
+        for (int32 n = 0; n < count; n++) {
+            x = first + (last_handle - first + 1 + n) % count;
+
+            sh = (special_handle_struct *)list_get(special_handles, x);
+            if (!sh)
+                continue;
+
+            if (connection_wait_ready(sh)) {
+                last_handle = x;
+                return -1 - x;
+            }
+
+            if (connection_wait_add(sh, fds))
+                fd_handles.push_back(x);
+        }
+
+        // Only wait in small slices so that ON TIMER and friends keep running
+        int32 wait_ms = 10;
+        if (deadline >= 0) {
+            int64_t remaining = deadline - GetTicks();
+            if (remaining <= 0)
+                return 0;
+            if (remaining < wait_ms)
+                wait_ms = remaining;
+        }
+
+        if (fds.empty()) {
+            Sleep(wait_ms);
+        } else if (tcp_poll(fds.data(), fds.size(), wait_ms) > 0) {
+            for (size_t n = 0; n < fds.size(); n++) {
+                if (!fds[n].revents)
+                    continue;
+
+                x = fd_handles[n];
+                sh = (special_handle_struct *)list_get(special_handles, x);
+                connection_struct *cs;
+
+                if (sh->type == special_handle_type::Host) {
+                    if (fds[n].revents & POLLIN) {
+                        last_handle = x;
+                        return -1 - x; // a connection is waiting to be accepted
+                    }
+                    continue;
+                }
+
+                stream_struct *ss = (stream_struct *)sh->index;
+                cs = (connection_struct *)ss->index;
+                tcp_connection *tcp = (tcp_connection *)cs->connection;
+
+                if (fds[n].revents & POLLOUT)
+                    tcp_flush(tcp);
+
+                if (fds[n].revents & (POLLIN | POLLERR | POLLHUP)) {
+                    stream_update(ss);
+                    if (connection_wait_ready(sh)) {
+                        last_handle = x;
+                        return -1 - x;
+                    }
+                }
+            }
+        }
+
+        evnt(0);
+        if (stop_program)
+            return 0;
+    }
+#else
+    return 0;
+#endif
+}
+
 int32 func__exit() {
     exit_blocked = 1;
     static int32 x;
@@ -28652,6 +28410,8 @@ int main(int argc, char *argv[]) {
     }
 #endif
 
+    console_output_init();
+
     libqb_log_init();
     libqb_log_info("Program starting.");
 
@@ -29184,6 +28944,7 @@ main_loop:
 end_program:
     stop_program = 1;
     qbevent = 1;
+    wake_timer_thread();
     while (exit_ok != 3)
         Sleep(16);
 
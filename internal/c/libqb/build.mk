@@ -3,6 +3,7 @@ libqb-objs-y += $(PATH_LIBQB)/src/threading.o
 libqb-objs-y += $(PATH_LIBQB)/src/buffer.o
 libqb-objs-y += $(PATH_LIBQB)/src/bitops.o
 libqb-objs-y += $(PATH_LIBQB)/src/command.o
+libqb-objs-y += $(PATH_LIBQB)/src/console.o
 libqb-objs-y += $(PATH_LIBQB)/src/environ.o
 libqb-objs-y += $(PATH_LIBQB)/src/file-fields.o
 libqb-objs-y += $(PATH_LIBQB)/src/filepath.o
@@ -22,8 +23,10 @@ libqb-objs-y += $(PATH_LIBQB)/src/qbs_mk_cv.o
 libqb-objs-y += $(PATH_LIBQB)/src/qbs_val.o
 libqb-objs-y += $(PATH_LIBQB)/src/string_functions.o
 libqb-objs-y += $(PATH_LIBQB)/src/graphics.o
+libqb-objs-y += $(PATH_LIBQB)/src/blit.o
 
 libqb-objs-y += $(PATH_LIBQB)/src/logging/logging.o
+libqb-objs-y += $(PATH_LIBQB)/src/logging/async.o
 libqb-objs-y += $(PATH_LIBQB)/src/logging/qb64pe_symbol.o
 libqb-objs-y += $(PATH_LIBQB)/src/logging/stacktrace.o
 libqb-objs-y += $(PATH_LIBQB)/src/logging/handlers/fp_handler.o
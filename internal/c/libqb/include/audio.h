@@ -66,6 +66,8 @@ static inline void sub__sndrawdone(int32_t handle, int32_t passed) {
 }
 
 double func__sndrawlen(int32_t handle, int32_t passed);
+int64_t func__sndrawoverruns(int32_t handle, int32_t passed);
+int64_t func__sndrawunderruns(int32_t handle, int32_t passed);
 
 mem_block func__memsound(int32_t handle, int32_t targetChannel, int32_t passed);
 int32_t func__sndnew(uint32_t frames, int32_t channels, int32_t bits, uint32_t sampleRate, int32_t passed);
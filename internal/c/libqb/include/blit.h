@@ -0,0 +1,23 @@
+//----------------------------------------------------------------------------------------------------------------------
+// QB64-PE software blitter row kernels
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/// @brief Alpha blends a row of 32bpp source pixels over a row of destination pixels (source-over, same results as the per-pixel _PUTIMAGE path).
+/// The fastest kernel supported by the CPU (AVX2, SSE2 or scalar) is selected at runtime.
+/// @param dst The destination pixels. This cannot be NULL.
+/// @param src The source pixels. This cannot be NULL and must not overlap dst.
+/// @param count The number of pixels.
+void image_blit_row_blend32(uint32_t *dst, const uint32_t *src, size_t count);
+
+/// @brief Copies a row of 8bpp source pixels to the destination skipping pixels that match the clear (transparent) color.
+/// The fastest kernel supported by the CPU (AVX2, SSE2 or scalar) is selected at runtime.
+/// @param dst The destination pixels. This cannot be NULL.
+/// @param src The source pixels. This cannot be NULL and must not overlap dst.
+/// @param count The number of pixels.
+/// @param clearColor The color index that is not copied.
+void image_blit_row_keyed8(uint8_t *dst, const uint8_t *src, size_t count, uint8_t clearColor);
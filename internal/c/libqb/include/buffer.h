@@ -3,10 +3,16 @@
 
 #include <stdint.h>
 
+// Data is stored in a list of fixed size chunks, writes fill up the last chunk before starting a new one
+#define LIBQB_BUFFER_CHUNK_SIZE (16 * 1024)
+
+// Number of emptied chunks a buffer holds on to for reuse, instead of freeing them
+#define LIBQB_BUFFER_SPARE_CHUNKS 4
+
 struct libqb_buffer_entry {
-    size_t length;
-    char *data;
+    size_t length; // bytes of 'data' in use
     struct libqb_buffer_entry *next;
+    char data[LIBQB_BUFFER_CHUNK_SIZE];
 };
 
 struct libqb_buffer {
@@ -15,6 +21,11 @@ struct libqb_buffer {
 
     struct libqb_buffer_entry *head;
     struct libqb_buffer_entry **tail;
+
+    struct libqb_buffer_entry *last; // the entry 'tail' points after, NULL if the buffer is empty
+
+    struct libqb_buffer_entry *spare;
+    size_t spare_count;
 };
 
 void libqb_buffer_init(struct libqb_buffer *);
@@ -11,3 +11,11 @@ struct qbs;
 
 qbs *func__deflate(qbs *src, int32_t level = -1, int32_t passed = 0);
 qbs *func__inflate(qbs *text, int64_t originalsize, int32_t passed);
+qbs *compression_inflate_view(const uint8_t *src, int32_t srcSize, int32_t originalSize, uint8_t **cache);
+int32_t func__deflateopen(int32_t level, int32_t passed);
+qbs *func__deflatechunk(int32_t handle, qbs *src, int32_t finish, int32_t passed);
+void sub__deflateclose(int32_t handle);
+int32_t func__inflateopen();
+qbs *func__inflatechunk(int32_t handle, qbs *src);
+int32_t func__inflateeof(int32_t handle);
+void sub__inflateclose(int32_t handle);
@@ -2,6 +2,7 @@
 #define INCLUDE_LIBQB_CONDVAR_H
 
 #include "mutex.h"
+#include <stdint.h>
 
 // Condition Variable
 struct libqb_condvar;
@@ -14,6 +15,10 @@ void libqb_condvar_free(struct libqb_condvar *);
 // Mutex while checking the Condition Variable
 void libqb_condvar_wait(struct libqb_condvar *, struct libqb_mutex *);
 
+// Same as libqb_condvar_wait(), but gives up after the timeout has passed.
+// Returns false if the wait timed out
+bool libqb_condvar_wait_for(struct libqb_condvar *, struct libqb_mutex *, uint64_t microseconds);
+
 // Signals a single thread waiting on the Condition Variable
 void libqb_condvar_signal(struct libqb_condvar *);
 
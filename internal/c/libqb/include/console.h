@@ -0,0 +1,12 @@
+#pragma once
+
+// Console output to a terminal is flushed on every PRINT, so it shows up as it
+// is written. When stdout is a pipe or a file it is block buffered instead, and
+// only handed to the OS when the buffer fills up or console_output_flush() is
+// called (INPUT, SHELL, SLEEP, END and _FLUSH do this).
+extern bool console_output_buffered;
+
+// Picks the buffering mode of stdout, called once at startup
+void console_output_init();
+
+void console_output_flush();
@@ -0,0 +1,39 @@
+//-----------------------------------------------------------------------------------------------------
+//  QB64-PE $EMBED support
+//
+//  The compiler copies every $EMBED file (deflated, when that pays off) into the temp folder and the
+//  generated embedded.cpp pulls it in with the assembler's .incbin, so the data never goes through
+//  the C++ parser. _EMBEDDED$() hands out read-only strings over that data instead of copies.
+//-----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <stdint.h>
+
+struct qbs;
+
+qbs *qbs_new_txt_len(const char *txt, int32_t len);
+
+#if defined(__APPLE__)
+#    define EMBED_SECTION ".const_data"
+#elif defined(_WIN32)
+#    define EMBED_SECTION ".section .rdata,\"dr\""
+#else
+#    define EMBED_SECTION ".section .rodata"
+#endif
+
+// Defines 'symbol' as the contents of the file at 'path' (relative to the directory make runs in).
+// The asm label keeps the symbol name the same on targets that prefix C symbols with an underscore.
+#define EMBED_INCBIN(symbol, path)                                                                                                                             \
+    extern "C" const uint8_t symbol[] __asm__(#symbol);                                                                                                        \
+    __asm__(EMBED_SECTION "\n"                                                                                                                                 \
+            ".globl " #symbol "\n"                                                                                                                             \
+            ".p2align 4\n"                                                                                                                                     \
+            #symbol ":\n"                                                                                                                                      \
+            ".incbin \"" path "\"\n"                                                                                                                           \
+            ".text\n")
+
+/// @brief Returns a temporary read-only string over embedded data, without copying it
+static inline qbs *embed_view(const uint8_t *data, int32_t size) {
+    return qbs_new_txt_len(reinterpret_cast<const char *>(data), size);
+}
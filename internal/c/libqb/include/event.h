@@ -20,6 +20,12 @@ int qb64_custom_event(int event, int v1, int v2, int v3, int v4, int v5, int v6,
 #endif
 
 extern uint32_t new_error;
-extern uint32_t qbevent;
+
+#ifdef __cplusplus
+#    include <atomic>
+
+// Set from any thread to make the main program call evnt() at its next statement
+extern std::atomic<uint32_t> qbevent;
+#endif
 
 #endif
@@ -36,6 +36,11 @@
     -11 bad file name
 */
 
+// default size of the read-ahead buffer used for files opened FOR INPUT
+#define GFS_DEFAULT_READ_BUFFER_SIZE 65536
+// default size of the write-behind buffer used for files opened FOR OUTPUT/APPEND
+#define GFS_DEFAULT_WRITE_BUFFER_SIZE 65536
+
 struct gfs_file_struct { // info applicable to all files
     int64_t id;          // a unique ID given to all files (currently only referenced by the FIELD statement to remove old field conditions)
     uint8_t open;
@@ -53,6 +58,17 @@ struct gfs_file_struct { // info applicable to all files
     qbs **field_strings;     // list of qbs pointers linked to this file
     int32_t field_strings_n; // number of linked strings
     int64_t column;          // used by OUTPUT/APPEND to tab correctly (base 0)
+    // read-ahead buffer (see gfs_enable_read_buffer)
+    // while allocated, the OS file position is always read_buffer_start + read_buffer_length
+    uint8_t *read_buffer;
+    int64_t read_buffer_size;   // capacity of read_buffer
+    int64_t read_buffer_start;  // file offset of read_buffer[0]
+    int64_t read_buffer_length; // number of valid bytes in read_buffer
+    // write-behind buffer (see gfs_enable_write_buffer)
+    // while it holds data, the OS file position is pos - write_buffer_length
+    uint8_t *write_buffer;
+    int64_t write_buffer_size;   // capacity of write_buffer
+    int64_t write_buffer_length; // number of bytes waiting to be written
 #ifdef GFS_C
     // GFS_C data follows: (unused by custom GFS interfaces)
     std::fstream *file_handle;
@@ -101,6 +117,13 @@ int32_t gfs_write(int32_t i, int64_t position, uint8_t *data, int64_t size);
 int32_t gfs_read(int32_t i, int64_t position, uint8_t *data, int64_t size);
 int64_t gfs_read_bytes();
 
+int32_t gfs_enable_read_buffer(int32_t i, int64_t size);
+int32_t gfs_read_peek(int32_t i, uint8_t **data, int64_t *size);
+int32_t gfs_read_skip(int32_t i, int64_t size);
+
+int32_t gfs_enable_write_buffer(int32_t i, int64_t size);
+int32_t gfs_flush(int32_t i);
+
 int32_t gfs_lock(int32_t i, int64_t offset_start, int64_t offset_end);
 int32_t gfs_unlock(int32_t i, int64_t offset_start, int64_t offset_end);
 
@@ -108,3 +131,4 @@ int32_t gfs_get_fileno(int file_number);
 gfs_file_struct *gfs_get_file_struct(int fileno);
 
 void gfs_close_all_files();
+void gfs_flush_all_files();
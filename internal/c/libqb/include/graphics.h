@@ -204,6 +204,11 @@ void sub__depthbuffer(int32_t options, int32_t dst, int32_t passed);
 void sub__maptriangle(int32_t cull_options, float sx1, float sy1, float sx2, float sy2, float sx3, float sy3, int32_t si, float dx1, float dy1, float dz1,
                       float dx2, float dy2, float dz2, float dx3, float dy3, float dz3, int32_t di, int32_t smooth_options, int32_t passed);
 
+// Draw lists of points, lines and filled boxes from a _MEM block, see graphics.cpp for the record layouts
+void sub__psetlist(void *blk, intptr_t count, int32_t passed);
+void sub__linelist(void *blk, intptr_t count, int32_t passed);
+void sub__boxlist(void *blk, intptr_t count, int32_t passed);
+
 static inline constexpr uint8_t image_get_bgra_red(uint32_t c) {
     return uint8_t((c >> 16) & 0xFFu);
 }
@@ -340,6 +345,56 @@ static inline void image_swap_red_blue_buffer(uint32_t *buffer, size_t size) {
     }
 }
 
+/// @brief Combines two alpha values the way stacked translucent layers do ("60%+60%=84%", i.e. 1 - (1 - a1) * (1 - a2)), rounded to nearest.
+/// @param a1 The first alpha value (0 - 255).
+/// @param a2 The second alpha value (0 - 255).
+/// @return The combined alpha value (0 - 255).
+static inline constexpr uint32_t image_blend_alpha(uint32_t a1, uint32_t a2) {
+    auto x = 255u * 255u - (255u - a1) * (255u - a2) + 127u;
+    return (x + 1u + (x >> 8)) >> 8; // x / 255 (exact for x < 65535)
+}
+
+/// @brief Spreads the blue, green and red channels of a BGRA color into the low three 16-bit lanes of a 64-bit integer.
+static inline constexpr uint64_t image_bgr_to_lanes(uint32_t c) {
+    return uint64_t(c & 0xFFu) | (uint64_t(c & 0xFF00u) << 8) | (uint64_t(c & 0xFF0000u) << 16);
+}
+
+/// @brief Packs three 16-bit lanes (each 0 - 255) back into the blue, green and red channels of a BGRA color.
+static inline constexpr uint32_t image_lanes_to_bgr(uint64_t l) {
+    return uint32_t(l & 0xFFu) | uint32_t((l >> 8) & 0xFF00u) | uint32_t((l >> 16) & 0xFF0000u);
+}
+
+/// @brief Divides each of the three 16-bit lanes by 255 (exact as long as every lane is below 65535).
+static inline constexpr uint64_t image_lanes_div255(uint64_t l) {
+    return ((l + 0x000100010001u + ((l >> 8) & 0x00FF00FF00FFu)) >> 8) & 0x00FF00FF00FFu;
+}
+
+/// @brief Alpha blends a source color over a destination pixel using the source alpha.
+/// The color channels are blended in parallel in 16-bit lanes of a 64-bit integer. The result is bit-identical to the 16MB float-built lookup table
+/// that was used before.
+/// @param dst The destination pixel.
+/// @param src The source color.
+/// @return The blended pixel.
+static inline constexpr uint32_t image_blend_bgra(uint32_t dst, uint32_t src) {
+    auto a = src >> 24;
+    auto l = image_bgr_to_lanes(src) * a + image_bgr_to_lanes(dst) * (255u - a) + 0x007F007F007Fu; // +127 per lane rounds to nearest
+    return image_lanes_to_bgr(image_lanes_div255(l)) | (image_blend_alpha(dst >> 24, a) << 24);
+}
+
+/// @brief Alpha blends a single source color over a run of destination pixels (see image_blend_bgra()).
+/// @param dst The destination pixels. This cannot be NULL.
+/// @param count The number of pixels.
+/// @param src The source color.
+static inline void image_blend_bgra_span(uint32_t *dst, size_t count, uint32_t src) {
+    auto a = src >> 24;
+    auto srcLanes = image_bgr_to_lanes(src) * a + 0x007F007F007Fu;
+
+    for (size_t i = 0; i < count; i++) {
+        auto d = dst[i];
+        dst[i] = image_lanes_to_bgr(image_lanes_div255(srcLanes + image_bgr_to_lanes(d) * (255u - a))) | (image_blend_alpha(d >> 24, a) << 24);
+    }
+}
+
 /// @brief Finds the closest color index in the palette.
 /// @tparam DistFunc The distance function to use (see above).
 /// @param r The red color component.
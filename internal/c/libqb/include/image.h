@@ -42,4 +42,9 @@
 struct qbs;
 
 int32_t func__loadimage(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int32_t passed);
+int32_t func__loadimageasync(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int32_t passed);
+int32_t func__loadimageready(int32_t ticket);
+int32_t func__loadimagewait(int32_t ticket);
 void sub__saveimage(qbs *qbsFileName, int32_t imageHandle, qbs *qbsRequirements, int32_t passed);
+void sub__scaleimage(int32_t srcHandle, int32_t dstHandle, qbs *qbsScaler);
+int32_t func__scaleimage(int32_t srcHandle, qbs *qbsScaler);
@@ -39,4 +39,13 @@ int libqb_http_get(int handle, char *buf, size_t *length);
 // Returns an error if less than length bytes are available to read
 int libqb_http_get_fixed(int handle, char *buf, size_t length);
 
+struct libqb_http_stats {
+    uint64_t requests;           // requests that have finished
+    uint64_t connections;        // new connections made for those requests
+    uint64_t reused_connections; // successful requests that were sent over an already open (kept alive) connection
+};
+
+// Fills in the connection statistics for all HTTP requests made so far
+void libqb_http_get_stats(struct libqb_http_stats *stats);
+
 #endif
@@ -27,6 +27,8 @@ struct qbs {
     uint8_t fixed;    // fixed length string
     uint8_t readonly; // set to 1 if string is read only
 
+    int32_t capacity; // bytes reserved at chr by qbs_append, only meaningful while it is the last listed string
+
     qbs_field *field;
 };
 
@@ -37,6 +39,7 @@ qbs *qbs_new_txt_len(const char *txt, int32_t len);
 qbs *qbs_new_fixed(uint8_t *offset, uint32_t size, uint8_t tmp);
 qbs *qbs_add(qbs *, qbs *);
 qbs *qbs_set(qbs *, qbs *);
+qbs *qbs_append(qbs *, qbs *);
 
 void qbs_free(qbs *str);
 
@@ -0,0 +1,170 @@
+#ifndef INCLUDE_LIBQB_RING_QUEUE_H
+#define INCLUDE_LIBQB_RING_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <stddef.h>
+#include <thread>
+#include <vector>
+
+// A single-producer / single-consumer queue built on a fixed-capacity lock-free ring.
+//
+// When the ring is full the producer spills the rest into an overflow vector instead of dropping it. The consumer
+// moves the overflow into the ring as it drains, but only if it can take the overflow lock without waiting, so
+// pop() never blocks. Only one thread may push and only one (other) thread may pop.
+template <typename T> class libqb_ring_queue {
+  public:
+    // The capacity is rounded up to a power of two so that wrapping the indices is a simple mask
+    explicit libqb_ring_queue(size_t minCapacity) {
+        capacity_ = 1;
+        while (capacity_ < minCapacity)
+            capacity_ <<= 1;
+        mask = capacity_ - 1;
+        ring = new T[capacity_];
+
+        readIndex.store(0, std::memory_order_relaxed);
+        writeIndex.store(0, std::memory_order_relaxed);
+        overflowCursor = 0;
+        overflowPending.store(false, std::memory_order_relaxed);
+        overflowLock.clear(std::memory_order_relaxed);
+    }
+
+    ~libqb_ring_queue() {
+        delete[] ring;
+    }
+
+    libqb_ring_queue(const libqb_ring_queue &) = delete;
+    libqb_ring_queue &operator=(const libqb_ring_queue &) = delete;
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    // True while items are waiting in the overflow vector
+    bool spilling() const {
+        return overflowPending.load(std::memory_order_acquire);
+    }
+
+    // Producer side. Pushes count items, itemAt(i) returns the item at index i in [0, count).
+    // Returns true if the ring was full and this push started spilling into the overflow vector.
+    template <typename ItemFn> bool push(size_t count, ItemFn &&itemAt) {
+        size_t written = 0;
+        bool startedSpilling = false;
+
+        // The common case (nothing waiting in the overflow vector) goes straight into the ring without taking the lock
+        if (!overflowPending.load(std::memory_order_acquire)) {
+            written = ring_write(count, itemAt);
+
+            if (written == count)
+                return false;
+        }
+
+        // The ring is full or older items are still waiting in the overflow vector, so ordering has to go through the overflow path
+        lock_overflow();
+
+        drain_overflow();
+
+        if (!overflowPending.load(std::memory_order_relaxed))
+            written += ring_write(count - written, [&itemAt, written](size_t i) { return itemAt(written + i); });
+
+        if (written < count) {
+            startedSpilling = !overflowPending.load(std::memory_order_relaxed);
+
+            for (auto i = written; i < count; i++)
+                overflow.push_back(itemAt(i));
+
+            overflowPending.store(true, std::memory_order_release);
+        }
+
+        overflowLock.clear(std::memory_order_release);
+
+        return startedSpilling;
+    }
+
+    // Consumer side. Copies up to count items into out and returns how many were copied. Never blocks.
+    size_t pop(T *out, size_t count) {
+        auto r = readIndex.load(std::memory_order_relaxed);
+        auto w = writeIndex.load(std::memory_order_acquire);
+
+        count = std::min(count, w - r);
+
+        if (count) {
+            // In up to two pieces if the items wrap around the end of the ring
+            auto start = r & mask;
+            auto first = std::min(count, capacity_ - start);
+            std::copy(ring + start, ring + start + first, out);
+            std::copy(ring, ring + (count - first), out + first);
+
+            readIndex.store(r + count, std::memory_order_release); // hand the space back to the producer
+        }
+
+        // Refill the ring from the overflow vector, but only if the producer is not using it right now
+        if (overflowPending.load(std::memory_order_acquire) && !overflowLock.test_and_set(std::memory_order_acquire)) {
+            drain_overflow();
+            overflowLock.clear(std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    // Producer side. Returns the number of items queued in the ring and the overflow vector.
+    size_t size() {
+        size_t pending = 0;
+
+        if (overflowPending.load(std::memory_order_acquire)) {
+            lock_overflow();
+            pending = overflow.size() - overflowCursor;
+            overflowLock.clear(std::memory_order_release);
+        }
+
+        return (writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire)) + pending;
+    }
+
+  private:
+    T *ring;
+    size_t capacity_;
+    size_t mask;
+    std::atomic<size_t> readIndex;  // free-running, only advanced by the consumer
+    std::atomic<size_t> writeIndex; // free-running, only advanced by whoever holds the overflow lock or the producer
+    std::vector<T> overflow;        // items that did not fit in the ring
+    size_t overflowCursor;          // the read cursor in the overflow vector
+    std::atomic_bool overflowPending;
+    std::atomic_flag overflowLock; // guards the overflow vector, the consumer only ever tries to take it
+
+    void lock_overflow() {
+        while (overflowLock.test_and_set(std::memory_order_acquire))
+            std::this_thread::yield(); // the consumer holds this only for a bounded copy
+    }
+
+    // Copies items into the free space of the ring, returns how many fit
+    template <typename ItemFn> size_t ring_write(size_t count, ItemFn &&itemAt) {
+        auto w = writeIndex.load(std::memory_order_relaxed);
+        auto r = readIndex.load(std::memory_order_acquire);
+
+        count = std::min(count, capacity_ - (w - r));
+
+        for (size_t i = 0; i < count; i++)
+            ring[(w + i) & mask] = itemAt(i);
+
+        writeIndex.store(w + count, std::memory_order_release); // publish the items to the consumer
+
+        return count;
+    }
+
+    // Moves as much of the overflow vector into the ring as will fit. The overflow lock must be held.
+    void drain_overflow() {
+        auto pending = overflow.size() - overflowCursor;
+        if (pending) {
+            auto src = overflow.data() + overflowCursor;
+            overflowCursor += ring_write(pending, [src](size_t i) { return src[i]; });
+        }
+
+        if (overflowCursor == overflow.size()) {
+            overflow.clear();
+            overflowCursor = 0;
+            overflowPending.store(false, std::memory_order_release);
+        }
+    }
+};
+
+#endif
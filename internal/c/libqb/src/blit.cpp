@@ -0,0 +1,241 @@
+//----------------------------------------------------------------------------------------------------------------------
+// QB64-PE software blitter row kernels
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "blit.h"
+#include "graphics.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#    define BLIT_X86 1
+#    include <immintrin.h>
+#endif
+
+/// @brief Blends one source pixel over one destination pixel. This is the reference behavior that the SIMD kernels must match bit for bit.
+static inline uint32_t blit_blend_pixel32(uint32_t dst, uint32_t src) {
+    switch (src & 0xFF000000) {
+    case 0xFF000000:
+        return src;
+
+    case 0x0:
+        return dst;
+
+    case 0x80000000:
+        return (((dst & 0xFEFEFE) + (src & 0xFEFEFE)) >> 1) + (image_blend_alpha(dst >> 24, 128) << 24);
+
+    case 0x7F000000:
+        return (((dst & 0xFEFEFE) + (src & 0xFEFEFE)) >> 1) + (image_blend_alpha(dst >> 24, 127) << 24);
+
+    default:
+        return image_blend_bgra(dst, src);
+    }
+}
+
+static void blit_row_blend32_scalar(uint32_t *dst, const uint32_t *src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = blit_blend_pixel32(dst[i], src[i]);
+    }
+}
+
+static void blit_row_keyed8_scalar(uint8_t *dst, const uint8_t *src, size_t count, uint8_t clearColor) {
+    for (size_t i = 0; i < count; i++) {
+        if (src[i] != clearColor) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+#ifdef BLIT_X86
+
+// How the vector kernels work:
+// The pixels are widened to 16-bit lanes (B, G, R, A per pixel) and every lane computes (s * a + d * (255 - a) + 127) / 255, which is exactly
+// image_blend_bgra() for the color channels. The alpha lanes compute image_blend_alpha() instead. This single formula also gives the right result
+// for fully opaque (copy) and fully transparent (keep) pixels, so only the ~50% alpha shortcut of the scalar path needs a separate select.
+
+__attribute__((target("sse2"))) static inline __m128i blit_blend_lanes_sse2(__m128i s16, __m128i d16) {
+    const auto c1 = _mm_set1_epi16(1);
+    const auto c127 = _mm_set1_epi16(127);
+    const auto c255 = _mm_set1_epi16(255);
+    const auto c65152 = _mm_set1_epi16(int16_t(255 * 255 + 127));
+    const auto alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+
+    auto a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, 0xFF), 0xFF); // broadcast each pixel's source alpha to its 4 lanes
+    auto ia = _mm_sub_epi16(c255, a);
+    auto x = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(s16, a), _mm_mullo_epi16(d16, ia)), c127);
+    auto xa = _mm_sub_epi16(c65152, _mm_mullo_epi16(_mm_sub_epi16(c255, d16), ia));
+    x = _mm_or_si128(_mm_and_si128(alphaLanes, xa), _mm_andnot_si128(alphaLanes, x));
+
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, c1), _mm_srli_epi16(x, 8)), 8); // x / 255
+}
+
+__attribute__((target("sse2"))) static void blit_row_blend32_sse2(uint32_t *dst, const uint32_t *src, size_t count) {
+    const auto zero = _mm_setzero_si128();
+    const auto alphaMask = _mm_set1_epi32(int32_t(0xFF000000));
+    const auto halfMask = _mm_set1_epi32(0x00FEFEFE);
+    const auto alpha127 = _mm_set1_epi32(0x7F000000);
+    const auto alpha128 = _mm_set1_epi32(int32_t(0x80000000));
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        auto s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        auto sa = _mm_and_si128(s, alphaMask);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, alphaMask)) == 0xFFFF) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), s); // all opaque
+            continue;
+        }
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, zero)) == 0xFFFF) {
+            continue; // all transparent
+        }
+
+        auto d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+        auto r = _mm_packus_epi16(blit_blend_lanes_sse2(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero)),
+                                  blit_blend_lanes_sse2(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero)));
+
+        auto half = _mm_or_si128(_mm_cmpeq_epi32(sa, alpha127), _mm_cmpeq_epi32(sa, alpha128));
+        auto avg = _mm_add_epi32(_mm_srli_epi32(_mm_add_epi32(_mm_and_si128(d, halfMask), _mm_and_si128(s, halfMask)), 1), _mm_and_si128(r, alphaMask));
+        r = _mm_or_si128(_mm_and_si128(half, avg), _mm_andnot_si128(half, r));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), r);
+    }
+
+    blit_row_blend32_scalar(dst + i, src + i, count - i);
+}
+
+__attribute__((target("sse2"))) static void blit_row_keyed8_sse2(uint8_t *dst, const uint8_t *src, size_t count, uint8_t clearColor) {
+    const auto key = _mm_set1_epi8(int8_t(clearColor));
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        auto s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        auto d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+        auto m = _mm_cmpeq_epi8(s, key);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_or_si128(_mm_and_si128(m, d), _mm_andnot_si128(m, s)));
+    }
+
+    blit_row_keyed8_scalar(dst + i, src + i, count - i, clearColor);
+}
+
+__attribute__((target("avx2"))) static inline __m256i blit_blend_lanes_avx2(__m256i s16, __m256i d16) {
+    const auto c1 = _mm256_set1_epi16(1);
+    const auto c127 = _mm256_set1_epi16(127);
+    const auto c255 = _mm256_set1_epi16(255);
+    const auto c65152 = _mm256_set1_epi16(int16_t(255 * 255 + 127));
+    const auto alphaLanes = _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0);
+
+    auto a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s16, 0xFF), 0xFF);
+    auto ia = _mm256_sub_epi16(c255, a);
+    auto x = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(s16, a), _mm256_mullo_epi16(d16, ia)), c127);
+    auto xa = _mm256_sub_epi16(c65152, _mm256_mullo_epi16(_mm256_sub_epi16(c255, d16), ia));
+    x = _mm256_blendv_epi8(x, xa, alphaLanes);
+
+    return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, c1), _mm256_srli_epi16(x, 8)), 8);
+}
+
+__attribute__((target("avx2"))) static void blit_row_blend32_avx2(uint32_t *dst, const uint32_t *src, size_t count) {
+    const auto zero = _mm256_setzero_si256();
+    const auto alphaMask = _mm256_set1_epi32(int32_t(0xFF000000));
+    const auto halfMask = _mm256_set1_epi32(0x00FEFEFE);
+    const auto alpha127 = _mm256_set1_epi32(0x7F000000);
+    const auto alpha128 = _mm256_set1_epi32(int32_t(0x80000000));
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        auto s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        auto sa = _mm256_and_si256(s, alphaMask);
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(sa, alphaMask)) == -1) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), s);
+            continue;
+        }
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(sa, zero)) == -1) {
+            continue;
+        }
+
+        // unpack/pack work within each 128-bit half, so the pixel order is preserved
+        auto d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+        auto r = _mm256_packus_epi16(blit_blend_lanes_avx2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero)),
+                                     blit_blend_lanes_avx2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero)));
+
+        auto half = _mm256_or_si256(_mm256_cmpeq_epi32(sa, alpha127), _mm256_cmpeq_epi32(sa, alpha128));
+        auto avg = _mm256_add_epi32(_mm256_srli_epi32(_mm256_add_epi32(_mm256_and_si256(d, halfMask), _mm256_and_si256(s, halfMask)), 1),
+                                    _mm256_and_si256(r, alphaMask));
+        r = _mm256_blendv_epi8(r, avg, half);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), r);
+    }
+
+    blit_row_blend32_sse2(dst + i, src + i, count - i);
+}
+
+__attribute__((target("avx2"))) static void blit_row_keyed8_avx2(uint8_t *dst, const uint8_t *src, size_t count, uint8_t clearColor) {
+    const auto key = _mm256_set1_epi8(int8_t(clearColor));
+
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        auto s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        auto d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_blendv_epi8(s, d, _mm256_cmpeq_epi8(s, key)));
+    }
+
+    blit_row_keyed8_sse2(dst + i, src + i, count - i, clearColor);
+}
+
+enum class BlitLevel { SCALAR, SSE2, AVX2 };
+
+static BlitLevel blit_get_level() {
+    static const auto level = [] {
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2"))
+            return BlitLevel::AVX2;
+
+        if (__builtin_cpu_supports("sse2"))
+            return BlitLevel::SSE2;
+
+        return BlitLevel::SCALAR;
+    }();
+
+    return level;
+}
+
+#endif
+
+void image_blit_row_blend32(uint32_t *dst, const uint32_t *src, size_t count) {
+#ifdef BLIT_X86
+    switch (blit_get_level()) {
+    case BlitLevel::AVX2:
+        blit_row_blend32_avx2(dst, src, count);
+        return;
+
+    case BlitLevel::SSE2:
+        blit_row_blend32_sse2(dst, src, count);
+        return;
+
+    default:
+        break;
+    }
+#endif
+
+    blit_row_blend32_scalar(dst, src, count);
+}
+
+void image_blit_row_keyed8(uint8_t *dst, const uint8_t *src, size_t count, uint8_t clearColor) {
+#ifdef BLIT_X86
+    switch (blit_get_level()) {
+    case BlitLevel::AVX2:
+        blit_row_keyed8_avx2(dst, src, count, clearColor);
+        return;
+
+    case BlitLevel::SSE2:
+        blit_row_keyed8_sse2(dst, src, count, clearColor);
+        return;
+
+    default:
+        break;
+    }
+#endif
+
+    blit_row_keyed8_scalar(dst, src, count, clearColor);
+}
@@ -13,9 +13,30 @@ void libqb_buffer_init(struct libqb_buffer *buffer) {
     buffer->tail = &buffer->head;
 }
 
-static void libqb_buffer_entry_free(struct libqb_buffer_entry *ent) {
-    free(ent->data);
-    free(ent);
+static struct libqb_buffer_entry *libqb_buffer_entry_new(struct libqb_buffer *buffer) {
+    struct libqb_buffer_entry *ent = buffer->spare;
+
+    if (ent) {
+        buffer->spare = ent->next;
+        buffer->spare_count--;
+    } else {
+        ent = (struct libqb_buffer_entry *)malloc(sizeof(*ent));
+    }
+
+    ent->length = 0;
+    ent->next = NULL;
+
+    return ent;
+}
+
+static void libqb_buffer_entry_free(struct libqb_buffer *buffer, struct libqb_buffer_entry *ent) {
+    if (buffer->spare_count < LIBQB_BUFFER_SPARE_CHUNKS) {
+        ent->next = buffer->spare;
+        buffer->spare = ent;
+        buffer->spare_count++;
+    } else {
+        free(ent);
+    }
 }
 
 void libqb_buffer_clear(struct libqb_buffer *buffer) {
@@ -24,7 +45,17 @@ void libqb_buffer_clear(struct libqb_buffer *buffer) {
     while (entry) {
         struct libqb_buffer_entry *nxt = entry->next;
 
-        libqb_buffer_entry_free(entry);
+        free(entry);
+
+        entry = nxt;
+    }
+
+    entry = buffer->spare;
+
+    while (entry) {
+        struct libqb_buffer_entry *nxt = entry->next;
+
+        free(entry);
 
         entry = nxt;
     }
@@ -58,7 +89,7 @@ size_t libqb_buffer_read(struct libqb_buffer *buffer, char *out, size_t length)
             buffer->head = buffer->head->next;
             buffer->cur_entry_offset = 0;
 
-            libqb_buffer_entry_free(entry);
+            libqb_buffer_entry_free(buffer, entry);
         } else {
             // We didn't use the whole buffer, length == 0, loop will end
             buffer->cur_entry_offset = offset + len;
@@ -66,8 +97,10 @@ size_t libqb_buffer_read(struct libqb_buffer *buffer, char *out, size_t length)
     }
 
     // If the list is now empty, we need to reset the tail pointer
-    if (!buffer->head)
+    if (!buffer->head) {
         buffer->tail = &buffer->head;
+        buffer->last = NULL;
+    }
 
     buffer->total_length -= actual_length;
 
@@ -75,15 +108,28 @@ size_t libqb_buffer_read(struct libqb_buffer *buffer, char *out, size_t length)
 }
 
 void libqb_buffer_write(struct libqb_buffer *buffer, const char *in, size_t length) {
-    struct libqb_buffer_entry *new_ent = (struct libqb_buffer_entry *)malloc(sizeof(*new_ent));
+    buffer->total_length += length;
 
-    new_ent->length = length;
-    new_ent->next = NULL;
-    new_ent->data = (char *)malloc(length);
+    while (length) {
+        struct libqb_buffer_entry *ent = buffer->last;
 
-    memcpy(new_ent->data, in, length);
+        // Start a new chunk if the last one is full
+        if (!ent || ent->length == LIBQB_BUFFER_CHUNK_SIZE) {
+            ent = libqb_buffer_entry_new(buffer);
 
-    *buffer->tail = new_ent;
-    buffer->tail = &new_ent->next;
-    buffer->total_length += length;
+            *buffer->tail = ent;
+            buffer->tail = &ent->next;
+            buffer->last = ent;
+        }
+
+        size_t len = LIBQB_BUFFER_CHUNK_SIZE - ent->length;
+        if (len > length)
+            len = length;
+
+        memcpy(ent->data + ent->length, in, len);
+
+        ent->length += len;
+        in += len;
+        length -= len;
+    }
 }
@@ -0,0 +1,36 @@
+
+#include "libqb-common.h"
+
+#include <iostream>
+#include <stdio.h>
+
+#ifdef QB64_WINDOWS
+#    include <io.h>
+#else
+#    include <unistd.h>
+#endif
+
+#include "console.h"
+
+#define CONSOLE_OUTPUT_BUFFER_SIZE 65536
+
+bool console_output_buffered = false;
+
+void console_output_init() {
+#ifdef QB64_WINDOWS
+    if (_isatty(_fileno(stdout)))
+        return;
+#else
+    if (isatty(fileno(stdout)))
+        return;
+#endif
+
+    // std::cout is synchronized with stdio, so this is the buffer it writes into
+    if (setvbuf(stdout, NULL, _IOFBF, CONSOLE_OUTPUT_BUFFER_SIZE) == 0)
+        console_output_buffered = true;
+}
+
+void console_output_flush() {
+    std::cout.flush();
+    fflush(stdout);
+}
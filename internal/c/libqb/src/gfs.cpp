@@ -20,6 +20,8 @@ static int32_t gfs_freed_size = 0;
 static int32_t *gfs_fileno = (int32_t *)malloc(1);
 static int32_t gfs_fileno_n = 0;
 
+static int32_t gfs_write_buffer_flush(gfs_file_struct *f);
+
 int32_t gfs_get_fileno(int file_number) {
     return gfs_fileno[file_number];
 }
@@ -35,6 +37,13 @@ void gfs_close_all_files() {
     }
 }
 
+void gfs_flush_all_files() {
+    for (int32_t i = 1; i <= gfs_fileno_n; i++) {
+        if (gfs_fileno_valid(i) == 1)
+            gfs_flush(gfs_get_fileno(i));
+    }
+}
+
 int32_t gfs_new() {
     int32_t i;
     if (gfs_freed_n) {
@@ -115,6 +124,9 @@ int32_t gfs_free(int32_t i) {
 
 int32_t gfs_close(int32_t i) {
     int32_t x;
+    if (gfs_validhandle(i))
+        gfs_write_buffer_flush(&gfs_file[i]); // note: like fclose(), errors writing out buffered data are not reported
+
     if ((x = gfs_free(i)))
         return x;
 
@@ -128,6 +140,14 @@ int32_t gfs_close(int32_t i) {
         free(gfs_file[i].field_strings);
         gfs_file[i].field_strings = NULL;
     }
+    if (gfs_file[i].read_buffer) {
+        free(gfs_file[i].read_buffer);
+        gfs_file[i].read_buffer = NULL;
+    }
+    if (gfs_file[i].write_buffer) {
+        free(gfs_file[i].write_buffer);
+        gfs_file[i].write_buffer = NULL;
+    }
 
 #ifdef GFS_C
     gfs_file_struct *f = &gfs_file[i];
@@ -145,19 +165,31 @@ int32_t gfs_close(int32_t i) {
     return -1;
 }
 
+// returns the position the OS file pointer is actually at, which differs from f->pos while data is buffered
+static int64_t gfs_os_pos(gfs_file_struct *f) {
+    if (f->read_buffer)
+        return f->read_buffer_start + f->read_buffer_length;
+    return f->pos - f->write_buffer_length;
+}
+
 int64_t gfs_lof(int32_t i) {
     if (!gfs_validhandle(i))
         return -2; // invalid handle
     gfs_file_struct *f = &gfs_file[i];
     if (f->scrn)
         return -4;
+
+    auto x = gfs_write_buffer_flush(f);
+    if (x)
+        return x;
+
 #ifdef GFS_C
     f->file_handle->clear();
     if (f->read) {
         int64_t bytes;
         f->file_handle->seekg(0, std::ios::end);
         bytes = f->file_handle->tellg();
-        f->file_handle->seekg(f->pos);
+        f->file_handle->seekg(gfs_os_pos(f));
         return bytes;
     }
     if (f->write) {
@@ -908,6 +940,24 @@ int32_t gfs_setpos(int32_t i, int64_t position) {
     static gfs_file_struct *f;
     f = &gfs_file[i];
 
+    static int32_t x;
+    if ((x = gfs_write_buffer_flush(f)))
+        return x;
+
+    if (f->read_buffer) {
+        if (position >= f->read_buffer_start && position <= f->read_buffer_start + f->read_buffer_length) {
+            // the new position is covered by the read-ahead buffer, so the OS file pointer can stay where it is
+            f->pos = position;
+            f->eof_passed = 0;
+            f->eof_reached = 0;
+            return 0;
+        }
+
+        // discard the buffer, the OS file pointer is moved to the new position below
+        f->read_buffer_start = position;
+        f->read_buffer_length = 0;
+    }
+
 #ifdef GFS_C
     if (f->read) {
         f->file_handle->clear();
@@ -952,35 +1002,20 @@ int64_t gfs_getpos(int32_t i) {
     return f->pos;
 }
 
-int32_t gfs_write(int32_t i, int64_t position, uint8_t *data, int64_t size) {
-    if (!gfs_validhandle(i))
-        return -2; // invalid handle
-
-    static gfs_file_struct *f;
-    f = &gfs_file[i];
-    if (!f->write)
-        return -3; // bad file mode
-    if (size < 0)
-        return -4; // illegal function call
-    static int32_t x;
-    if (position != -1) {
-        if ((x = gfs_setpos(i, position)))
-            return x; //(pass on error)
-    }
-
+// writes 'size' bytes at the current OS file position
+static int32_t gfs_write_os(gfs_file_struct *f, uint8_t *data, int64_t size) {
 #ifdef GFS_C
     f->file_handle->clear();
     f->file_handle->write((char *)data, size);
     if (f->file_handle->bad()) {
         return -7; // assume: permission denied
     }
-    f->pos += size;
     return 0;
 #endif
 
 #ifdef GFS_WINDOWS
     static uint32_t size2;
-    static int64_t written = 0;
+    static DWORD written;
     while (size) {
         if (size > 4294967295) {
             size2 = 4294967295;
@@ -989,14 +1024,14 @@ int32_t gfs_write(int32_t i, int64_t position, uint8_t *data, int64_t size) {
             size2 = size;
             size = 0;
         }
-        if (!WriteFile(f->win_handle, data, size2, (unsigned long *)&written, NULL)) {
+        written = 0;
+        if (!WriteFile(f->win_handle, data, size2, &written, NULL)) {
             auto e = GetLastError();
             if ((e == 5) || (e == 33))
                 return -7; // permission denied
             return -9;     // assume: path/file access error
         }
         data += written;
-        f->pos += written;
         if (written != size2)
             return -1;
     }
@@ -1006,20 +1041,23 @@ int32_t gfs_write(int32_t i, int64_t position, uint8_t *data, int64_t size) {
     return -1;
 }
 
-int64_t gfs_read_bytes_value;
+// writes out any data held in the write-behind buffer
+static int32_t gfs_write_buffer_flush(gfs_file_struct *f) {
+    if (!f->write_buffer_length)
+        return 0;
 
-int64_t gfs_read_bytes() {
-    return gfs_read_bytes_value;
+    auto length = f->write_buffer_length;
+    f->write_buffer_length = 0; // the buffer is dropped even on failure, so the error is only reported once
+    return gfs_write_os(f, f->write_buffer, length);
 }
 
-int32_t gfs_read(int32_t i, int64_t position, uint8_t *data, int64_t size) {
-    gfs_read_bytes_value = 0;
+int32_t gfs_write(int32_t i, int64_t position, uint8_t *data, int64_t size) {
     if (!gfs_validhandle(i))
         return -2; // invalid handle
 
     static gfs_file_struct *f;
     f = &gfs_file[i];
-    if (!f->read)
+    if (!f->write)
         return -3; // bad file mode
     if (size < 0)
         return -4; // illegal function call
@@ -1029,28 +1067,97 @@ int32_t gfs_read(int32_t i, int64_t position, uint8_t *data, int64_t size) {
             return x; //(pass on error)
     }
 
+    if (f->write_buffer && size < f->write_buffer_size) {
+        if (f->write_buffer_length + size > f->write_buffer_size) {
+            if ((x = gfs_write_buffer_flush(f)))
+                return x;
+        }
+
+        memcpy(f->write_buffer + f->write_buffer_length, data, size);
+        f->write_buffer_length += size;
+        f->pos += size;
+        return 0;
+    }
+
+    // unbuffered or too large to be worth buffering
+    if ((x = gfs_write_buffer_flush(f)))
+        return x;
+
+    if ((x = gfs_write_os(f, data, size)))
+        return x;
+
+    f->pos += size;
+    return 0;
+}
+
+// enables write-behind buffering of 'size' bytes for a file which is only ever written sequentially
+int32_t gfs_enable_write_buffer(int32_t i, int64_t size) {
+    if (!gfs_validhandle(i))
+        return -2; // invalid handle
+
+    gfs_file_struct *f = &gfs_file[i];
+    if (!f->write || f->read || f->scrn)
+        return -3; // bad file mode
+    if (size <= 0)
+        return -4; // illegal function call
+    if (f->write_buffer)
+        return 0;
+
+    f->write_buffer = (uint8_t *)malloc(size);
+    if (!f->write_buffer)
+        return -1;
+
+    f->write_buffer_size = size;
+    f->write_buffer_length = 0;
+    return 0;
+}
+
+// hands all buffered data over to the OS, so other programs opening the file can see it
+int32_t gfs_flush(int32_t i) {
+    if (!gfs_validhandle(i))
+        return -2; // invalid handle
+
+    gfs_file_struct *f = &gfs_file[i];
+    if (f->scrn || !f->write)
+        return 0;
+
+    auto x = gfs_write_buffer_flush(f);
+    if (x)
+        return x;
+
+#ifdef GFS_C
+    f->file_handle->flush();
+    if (f->file_handle->bad())
+        return -7; // assume: permission denied
+#endif
+
+    return 0;
+}
+
+int64_t gfs_read_bytes_value;
+
+int64_t gfs_read_bytes() {
+    return gfs_read_bytes_value;
+}
+
+// reads up to 'size' bytes from the current OS file position
+// 'bytesread' receives the number of bytes actually read, which is less than 'size' only if the end of the file was reached
+static int32_t gfs_read_os(gfs_file_struct *f, uint8_t *data, int64_t size, int64_t *bytesread) {
+    *bytesread = 0;
+
 #ifdef GFS_C
     f->file_handle->clear();
     f->file_handle->read((char *)data, size);
     if (f->file_handle->bad()) { // note: 'eof' also sets the 'fail' flag, so only the 'bad' flag is checked
         return -7;               // assume: permission denied
     }
-    static int64_t bytesread;
-    bytesread = f->file_handle->gcount();
-    gfs_read_bytes_value = bytesread;
-    f->pos += bytesread;
-    if (bytesread < size) {
-        memset(data + bytesread, 0, size - bytesread);
-        f->eof_passed = 1;
-        return -10;
-    }
-    f->eof_passed = 0;
+    *bytesread = f->file_handle->gcount();
     return 0;
 #endif
 
 #ifdef GFS_WINDOWS
     static uint32_t size2;
-    static int64_t bytesread = 0;
+    static DWORD chunkread;
     while (size) {
         if (size > 4294967295) {
             size2 = 4294967295;
@@ -1060,15 +1167,12 @@ int32_t gfs_read(int32_t i, int64_t position, uint8_t *data, int64_t size) {
             size = 0;
         }
 
-        if (ReadFile(f->win_handle, data, size2, (unsigned long *)&bytesread, NULL)) {
-            data += bytesread;
-            f->pos += bytesread;
-            gfs_read_bytes_value += bytesread;
-            if (bytesread != size2) {
-                ZeroMemory(data, size + (size2 - bytesread)); // nullify remaining buffer
-                f->eof_passed = 1;
-                return -10;
-            } // eof passed
+        chunkread = 0;
+        if (ReadFile(f->win_handle, data, size2, &chunkread, NULL)) {
+            data += chunkread;
+            *bytesread += chunkread;
+            if (chunkread != size2)
+                return 0; // eof reached
         } else {
             // error
             auto e = GetLastError();
@@ -1078,16 +1182,193 @@ int32_t gfs_read(int32_t i, int64_t position, uint8_t *data, int64_t size) {
             return -9; // assume: path/file access error
         }
     }
-    f->eof_passed = 0;
     return 0;
 #endif
 
     return -1;
 }
 
+// empties the read-ahead buffer at the current position, moving the OS file pointer there if required
+static int32_t gfs_read_buffer_reset(int32_t i) {
+    gfs_file_struct *f = &gfs_file[i];
+
+    if (f->pos != gfs_os_pos(f)) {
+        f->read_buffer_start = -1;
+        f->read_buffer_length = 0;
+
+        auto x = gfs_setpos(i, f->pos);
+        if (x)
+            return x;
+    }
+
+    f->read_buffer_start = f->pos;
+    f->read_buffer_length = 0;
+    return 0;
+}
+
+// refills the read-ahead buffer from the current position
+// the buffer is left empty (without error) if the end of the file was reached
+static int32_t gfs_read_buffer_fill(int32_t i) {
+    gfs_file_struct *f = &gfs_file[i];
+
+    auto x = gfs_read_buffer_reset(i);
+    if (x)
+        return x;
+
+    int64_t bytesread;
+    x = gfs_read_os(f, f->read_buffer, f->read_buffer_size, &bytesread);
+    f->read_buffer_length = bytesread;
+    return x;
+}
+
+int32_t gfs_read(int32_t i, int64_t position, uint8_t *data, int64_t size) {
+    gfs_read_bytes_value = 0;
+    if (!gfs_validhandle(i))
+        return -2; // invalid handle
+
+    static gfs_file_struct *f;
+    f = &gfs_file[i];
+    if (!f->read)
+        return -3; // bad file mode
+    if (size < 0)
+        return -4; // illegal function call
+    static int32_t x;
+    if ((x = gfs_write_buffer_flush(f)))
+        return x;
+    if (position != -1) {
+        if ((x = gfs_setpos(i, position)))
+            return x; //(pass on error)
+    }
+
+    static int64_t bytesread;
+
+    if (f->read_buffer) {
+        bytesread = 0;
+        while (bytesread < size) {
+            auto offset = f->pos - f->read_buffer_start;
+            auto available = f->read_buffer_length - offset;
+
+            if (available > 0) {
+                auto n = size - bytesread;
+                if (n > available)
+                    n = available;
+
+                memcpy(data + bytesread, f->read_buffer + offset, n);
+                bytesread += n;
+                f->pos += n;
+                continue;
+            }
+
+            if (size - bytesread >= f->read_buffer_size) {
+                // large reads bypass the buffer, which is left empty at the new position
+                int64_t n;
+                if ((x = gfs_read_buffer_reset(i)))
+                    return x;
+
+                if ((x = gfs_read_os(f, data + bytesread, size - bytesread, &n)))
+                    return x;
+
+                bytesread += n;
+                f->pos += n;
+                f->read_buffer_start = f->pos;
+                break;
+            }
+
+            if ((x = gfs_read_buffer_fill(i)))
+                return x;
+
+            if (!f->read_buffer_length)
+                break; // eof
+        }
+    } else {
+        if ((x = gfs_read_os(f, data, size, &bytesread)))
+            return x;
+
+        f->pos += bytesread;
+    }
+
+    gfs_read_bytes_value = bytesread;
+    if (bytesread < size) {
+        memset(data + bytesread, 0, size - bytesread);
+        f->eof_passed = 1;
+        return -10;
+    }
+    f->eof_passed = 0;
+    return 0;
+}
+
+// enables read-ahead buffering of 'size' bytes for a file which is only ever read sequentially
+int32_t gfs_enable_read_buffer(int32_t i, int64_t size) {
+    if (!gfs_validhandle(i))
+        return -2; // invalid handle
+
+    gfs_file_struct *f = &gfs_file[i];
+    if (!f->read || f->write || f->scrn)
+        return -3; // bad file mode
+    if (size <= 0)
+        return -4; // illegal function call
+    if (f->read_buffer)
+        return 0;
+
+    f->read_buffer = (uint8_t *)malloc(size);
+    if (!f->read_buffer)
+        return -1;
+
+    f->read_buffer_size = size;
+    f->read_buffer_start = f->pos;
+    f->read_buffer_length = 0;
+    return 0;
+}
+
+// gives direct access to the read-ahead buffer without copying
+// on success 'data' points at the byte at the current position and 'size' is the number of bytes available (at least 1)
+// returns -10 (and sets the EOF flag like gfs_read) if there is nothing left to read
+int32_t gfs_read_peek(int32_t i, uint8_t **data, int64_t *size) {
+    *size = 0;
+    if (!gfs_validhandle(i))
+        return -2; // invalid handle
+
+    gfs_file_struct *f = &gfs_file[i];
+    if (!f->read || !f->read_buffer)
+        return -3; // bad file mode
+
+    if (f->pos >= f->read_buffer_start + f->read_buffer_length) {
+        auto x = gfs_read_buffer_fill(i);
+        if (x)
+            return x;
+
+        if (!f->read_buffer_length) {
+            f->eof_passed = 1;
+            return -10;
+        }
+    }
+
+    *data = f->read_buffer + (f->pos - f->read_buffer_start);
+    *size = f->read_buffer_start + f->read_buffer_length - f->pos;
+    f->eof_passed = 0;
+    return 0;
+}
+
+// consumes bytes previously returned by gfs_read_peek
+int32_t gfs_read_skip(int32_t i, int64_t size) {
+    if (!gfs_validhandle(i))
+        return -2; // invalid handle
+
+    gfs_file_struct *f = &gfs_file[i];
+    if (!f->read_buffer)
+        return -3; // bad file mode
+    if (size < 0 || f->pos + size > f->read_buffer_start + f->read_buffer_length)
+        return -4; // illegal function call
+
+    f->pos += size;
+    return 0;
+}
+
 int32_t gfs_eof_reached(int32_t i) {
     if (!gfs_validhandle(i))
         return -2; // invalid handle
+    if (gfs_file[i].read_buffer && gfs_file[i].pos < gfs_file[i].read_buffer_start + gfs_file[i].read_buffer_length)
+        return 0; // there is still buffered data to read
     if (gfs_getpos(i) >= gfs_lof(i))
         return 1;
     return 0;
@@ -1129,6 +1410,7 @@ int32_t gfs_lock(int32_t i, int64_t offset_start, int64_t offset_end) {
         bytes = bytes - offset_start + 1;
 
     auto f = &gfs_file[i];
+    gfs_write_buffer_flush(f); // buffered data must reach the file before the locks change
 
     if (!LockFile(f->win_handle, *((DWORD *)(&offset_start)), *(((DWORD *)(&offset_start)) + 1), *((DWORD *)(&bytes)), *(((DWORD *)(&bytes)) + 1))) {
         // failed
@@ -1170,6 +1452,7 @@ int32_t gfs_unlock(int32_t i, int64_t offset_start, int64_t offset_end) {
         bytes = bytes - offset_start + 1;
 
     auto f = &gfs_file[i];
+    gfs_write_buffer_flush(f); // buffered data must reach the file before the locks change
 
     if (!UnlockFile(f->win_handle, *((DWORD *)(&offset_start)), *(((DWORD *)(&offset_start)) + 1), *((DWORD *)(&bytes)), *(((DWORD *)(&bytes)) + 1))) {
         // failed
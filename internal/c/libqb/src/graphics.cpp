@@ -5,14 +5,19 @@
 #include "graphics.h"
 #include "error_handle.h"
 #include "libqb-common.h"
+#include "memblock.h"
 #include "qblist.h"
 #include "rounding.h"
+#include <algorithm>
 #include <cstring>
 #include <limits>
 
 // External functions. These should be moved here in the future.
 void flush_old_hardware_commands();
 void validatepage(int32_t pageNumber);
+void pset(int32_t x, int32_t y, uint32_t col);
+void fast_boxfill(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t col);
+void lineclip(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t xmin, int32_t ymin, int32_t xmax, int32_t ymax);
 
 // Global variables. These should be cleaned up and moved here in the future.
 extern list *hardware_img_handles;
@@ -27,10 +32,8 @@ extern img_struct *img;
 extern img_struct *write_page;
 extern img_struct *read_page;
 extern img_struct *display_page;
-extern uint8_t *cblend;
-extern uint8_t *ablend;
-extern uint8_t *ablend127;
-extern uint8_t *ablend128;
+extern int32_t lineclip_draw;
+extern int32_t lineclip_x1, lineclip_y1, lineclip_x2, lineclip_y2;
 
 // Module-level global variables
 static int32_t depthbuffer_mode0 = DEPTHBUFFER_MODE__ON;
@@ -283,8 +286,7 @@ void sub__maptriangle(int32_t cull_options, float sx1, float sy1, float sx2, flo
     static uint32_t *dst_offset32;
     static uint8_t *src_offset;
     static uint32_t *src_offset32;
-    static uint32_t col, destcol;
-    static uint8_t *cp;
+    static uint32_t col;
 
     // hardware support
     // is source a hardware handle?
@@ -1463,17 +1465,15 @@ void sub__maptriangle(int32_t cull_options, float sx1, float sy1, float sx2, flo
                             case 0x0:
                                 break;
                             case 0x80000000:
-                                *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*pixel_offset32 >> 24] << 24);
+                                *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) +
+                                                  (image_blend_alpha(*pixel_offset32 >> 24, 128) << 24);
                                 break;
                             case 0x7F000000:
-                                *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*pixel_offset32 >> 24] << 24);
+                                *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) +
+                                                  (image_blend_alpha(*pixel_offset32 >> 24, 127) << 24);
                                 break;
                             default:
-                                destcol = *pixel_offset32;
-                                cp = cblend + (col >> 24 << 16);
-                                *pixel_offset32 = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                                  (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) +
-                                                  (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+                                *pixel_offset32 = image_blend_bgra(*pixel_offset32, col);
                             }; // switch
                             //--------done plot pixel--------
                             //<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -1503,17 +1503,15 @@ void sub__maptriangle(int32_t cull_options, float sx1, float sy1, float sx2, flo
                             case 0x0:
                                 break;
                             case 0x80000000:
-                                *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*pixel_offset32 >> 24] << 24);
+                                *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) +
+                                                  (image_blend_alpha(*pixel_offset32 >> 24, 128) << 24);
                                 break;
                             case 0x7F000000:
-                                *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*pixel_offset32 >> 24] << 24);
+                                *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) +
+                                                  (image_blend_alpha(*pixel_offset32 >> 24, 127) << 24);
                                 break;
                             default:
-                                destcol = *pixel_offset32;
-                                cp = cblend + (col >> 24 << 16);
-                                *pixel_offset32 = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                                  (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) +
-                                                  (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+                                *pixel_offset32 = image_blend_bgra(*pixel_offset32, col);
                             }; // switch
                             //--------done plot pixel--------
                             //<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -1560,16 +1558,13 @@ void sub__maptriangle(int32_t cull_options, float sx1, float sy1, float sx2, flo
                         case 0x0:
                             break;
                         case 0x80000000:
-                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*pixel_offset32 >> 24] << 24);
+                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*pixel_offset32 >> 24, 128) << 24);
                             break;
                         case 0x7F000000:
-                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*pixel_offset32 >> 24] << 24);
+                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*pixel_offset32 >> 24, 127) << 24);
                             break;
                         default:
-                            destcol = *pixel_offset32;
-                            cp = cblend + (col >> 24 << 16);
-                            *pixel_offset32 = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                              (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+                            *pixel_offset32 = image_blend_bgra(*pixel_offset32, col);
                         }; // switch
                         //--------done plot pixel--------
                         pixel_offset32++;
@@ -1767,16 +1762,13 @@ void sub__maptriangle(int32_t cull_options, float sx1, float sy1, float sx2, flo
                         case 0x0:
                             break;
                         case 0x80000000:
-                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*pixel_offset32 >> 24] << 24);
+                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*pixel_offset32 >> 24, 128) << 24);
                             break;
                         case 0x7F000000:
-                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*pixel_offset32 >> 24] << 24);
+                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*pixel_offset32 >> 24, 127) << 24);
                             break;
                         default:
-                            destcol = *pixel_offset32;
-                            cp = cblend + (col >> 24 << 16);
-                            *pixel_offset32 = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                              (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+                            *pixel_offset32 = image_blend_bgra(*pixel_offset32, col);
                         }; // switch
                         //--------done plot pixel--------
                         //<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -1806,16 +1798,13 @@ void sub__maptriangle(int32_t cull_options, float sx1, float sy1, float sx2, flo
                         case 0x0:
                             break;
                         case 0x80000000:
-                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*pixel_offset32 >> 24] << 24);
+                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*pixel_offset32 >> 24, 128) << 24);
                             break;
                         case 0x7F000000:
-                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*pixel_offset32 >> 24] << 24);
+                            *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*pixel_offset32 >> 24, 127) << 24);
                             break;
                         default:
-                            destcol = *pixel_offset32;
-                            cp = cblend + (col >> 24 << 16);
-                            *pixel_offset32 = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                              (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+                            *pixel_offset32 = image_blend_bgra(*pixel_offset32, col);
                         }; // switch
                         //--------done plot pixel--------
                         //<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -1862,16 +1851,13 @@ void sub__maptriangle(int32_t cull_options, float sx1, float sy1, float sx2, flo
                     case 0x0:
                         break;
                     case 0x80000000:
-                        *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend128[*pixel_offset32 >> 24] << 24);
+                        *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*pixel_offset32 >> 24, 128) << 24);
                         break;
                     case 0x7F000000:
-                        *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (ablend127[*pixel_offset32 >> 24] << 24);
+                        *pixel_offset32 = (((*pixel_offset32 & 0xFEFEFE) + (col & 0xFEFEFE)) >> 1) + (image_blend_alpha(*pixel_offset32 >> 24, 127) << 24);
                         break;
                     default:
-                        destcol = *pixel_offset32;
-                        cp = cblend + (col >> 24 << 16);
-                        *pixel_offset32 = cp[(col << 8 & 0xFF00) + (destcol & 255)] + (cp[(col & 0xFF00) + (destcol >> 8 & 255)] << 8) +
-                                          (cp[(col >> 8 & 0xFF00) + (destcol >> 16 & 255)] << 16) + (ablend[(col >> 24) + (destcol >> 16 & 0xFF00)] << 24);
+                        *pixel_offset32 = image_blend_bgra(*pixel_offset32, col);
                     }; // switch
                     //--------done plot pixel--------
                     pixel_offset32++;
@@ -2923,3 +2909,211 @@ void sub__maptriangle(int32_t cull_options, float sx1, float sy1, float sx2, flo
     error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
     return;
 } // sub__maptriangle
+
+// Record layouts read by _PSETLIST, _LINELIST and _BOXLIST. Records may be further apart than this (an array of a
+// TYPE with more fields after these), in which case the _MEM's element size is used as the distance between them.
+struct draw_list_point {
+    int32_t x, y;
+    uint32_t color;
+};
+
+struct draw_list_shape {
+    int32_t x1, y1, x2, y2;
+    uint32_t color;
+};
+
+/// @brief Checks the memory block given to a draw list statement and works out where its records are.
+/// @param blk The _MEM block holding the records.
+/// @param count The number of records to draw (only valid if passed).
+/// @param passed Set if count was passed.
+/// @param recordSize The size of one record.
+/// @param stride Receives the distance between two records.
+/// @return The number of records to draw. This is 0 if an error was raised.
+static intptr_t graphics_draw_list_records(mem_block *blk, intptr_t count, int32_t passed, intptr_t recordSize, intptr_t *stride) {
+    if (!blk->lock_offset) {
+        error(309); // memory not initialized
+        return 0;
+    }
+
+    if (((mem_lock *)blk->lock_offset)->id != blk->lock_id) {
+        error(308); // memory has been freed
+        return 0;
+    }
+
+    *stride = std::max<intptr_t>(blk->elementsize, recordSize);
+    auto available = blk->size >= recordSize ? (blk->size - recordSize) / *stride + 1 : 0;
+
+    if (!passed)
+        return available;
+
+    if (count < 0) {
+        error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
+        return 0;
+    }
+
+    if (count > available) {
+        error(300); // memory region out of range
+        return 0;
+    }
+
+    return count;
+}
+
+/// @brief Turns integer coordinates into write_page pixel coordinates the way PSET and LINE do (VIEW offset and WINDOW scaling).
+static inline void graphics_draw_list_resolve(int32_t &x, int32_t &y) {
+    if (write_page->clipping_or_scaling == 2) {
+        x = qbr_float_to_long(float(x) * write_page->scaling_x + write_page->scaling_offset_x) + write_page->view_offset_x;
+        y = qbr_float_to_long(float(y) * write_page->scaling_y + write_page->scaling_offset_y) + write_page->view_offset_y;
+    } else if (write_page->clipping_or_scaling) {
+        x += write_page->view_offset_x;
+        y += write_page->view_offset_y;
+    }
+}
+
+/// @brief Returns true if col replaces write_page pixels instead of being blended with them.
+static inline bool graphics_draw_list_is_opaque(uint32_t col) {
+    return write_page->bytes_per_pixel == 1 || write_page->alpha_disabled || (col >> 24) == 255;
+}
+
+/// @brief Draws a clipped line, stepping along the longer axis exactly like LINE does so that both set the same pixels.
+static void graphics_draw_list_line(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t col) {
+    lineclip(x1, y1, x2, y2, write_page->view_x1, write_page->view_y1, write_page->view_x2, write_page->view_y2);
+    if (!lineclip_draw)
+        return;
+
+    x1 = lineclip_x1;
+    y1 = lineclip_y1;
+    x2 = lineclip_x2;
+    y2 = lineclip_y2;
+
+    if (y1 == y2) { // a single span
+        if (x1 > x2)
+            std::swap(x1, x2);
+        fast_boxfill(x1, y1, x2, y2, col);
+        return;
+    }
+
+    // opaque pixels are just stored, lineclip() already kept the line on the page
+    auto opaque = graphics_draw_list_is_opaque(col);
+    if (write_page->bytes_per_pixel == 1)
+        col &= write_page->mask;
+
+    auto plot = [opaque, col](int32_t x, int32_t y) {
+        if (!opaque)
+            pset(x, y, col);
+        else if (write_page->bytes_per_pixel == 1)
+            write_page->offset[intptr_t(y) * write_page->width + x] = col;
+        else
+            write_page->offset32[intptr_t(y) * write_page->width + x] = col;
+    };
+
+    // The minor axis is a float stepped by the slope and rounded half away from zero, same as qb32_line()
+    int32_t l = std::abs(x1 - x2), l2 = std::abs(y1 - y2);
+    if (l > l2) {
+        auto m = (float(y2) - float(y1)) / float(l);
+        int32_t mi = x2 >= x1 ? 1 : -1;
+        float yf = y1;
+
+        for (l++; l--; x1 += mi, yf += m)
+            plot(x1, yf < 0 ? int32_t(yf - 0.5f) : int32_t(yf + 0.5f));
+    } else {
+        auto m = (float(x2) - float(x1)) / float(l2); // l2 is never 0 here, that is the single span above
+        int32_t mi = y2 >= y1 ? 1 : -1;
+        float xf = x1;
+
+        for (l2++; l2--; y1 += mi, xf += m)
+            plot(xf < 0 ? int32_t(xf - 0.5f) : int32_t(xf + 0.5f), y1);
+    }
+}
+
+void sub__psetlist(void *blk, intptr_t count, int32_t passed) {
+    if (is_error_pending())
+        return;
+
+    if (write_page->text) {
+        error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
+        return;
+    }
+
+    intptr_t stride;
+    count = graphics_draw_list_records((mem_block *)blk, count, passed, sizeof(draw_list_point), &stride);
+
+    auto record = (const uint8_t *)((mem_block *)blk)->offset;
+    draw_list_point pt;
+
+    for (; count > 0; count--, record += stride) {
+        memcpy(&pt, record, sizeof(pt));
+        graphics_draw_list_resolve(pt.x, pt.y);
+
+        if (pt.x < write_page->view_x1 || pt.x > write_page->view_x2 || pt.y < write_page->view_y1 || pt.y > write_page->view_y2)
+            continue;
+
+        if (write_page->bytes_per_pixel == 1)
+            write_page->offset[intptr_t(pt.y) * write_page->width + pt.x] = pt.color & write_page->mask;
+        else if (graphics_draw_list_is_opaque(pt.color))
+            write_page->offset32[intptr_t(pt.y) * write_page->width + pt.x] = pt.color;
+        else
+            pset(pt.x, pt.y, pt.color);
+    }
+}
+
+void sub__linelist(void *blk, intptr_t count, int32_t passed) {
+    if (is_error_pending())
+        return;
+
+    if (write_page->text) {
+        error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
+        return;
+    }
+
+    intptr_t stride;
+    count = graphics_draw_list_records((mem_block *)blk, count, passed, sizeof(draw_list_shape), &stride);
+
+    auto record = (const uint8_t *)((mem_block *)blk)->offset;
+    draw_list_shape ln;
+
+    for (; count > 0; count--, record += stride) {
+        memcpy(&ln, record, sizeof(ln));
+        graphics_draw_list_resolve(ln.x1, ln.y1);
+        graphics_draw_list_resolve(ln.x2, ln.y2);
+        graphics_draw_list_line(ln.x1, ln.y1, ln.x2, ln.y2, ln.color);
+    }
+}
+
+void sub__boxlist(void *blk, intptr_t count, int32_t passed) {
+    if (is_error_pending())
+        return;
+
+    if (write_page->text) {
+        error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
+        return;
+    }
+
+    intptr_t stride;
+    count = graphics_draw_list_records((mem_block *)blk, count, passed, sizeof(draw_list_shape), &stride);
+
+    auto record = (const uint8_t *)((mem_block *)blk)->offset;
+    draw_list_shape box;
+
+    for (; count > 0; count--, record += stride) {
+        memcpy(&box, record, sizeof(box));
+        graphics_draw_list_resolve(box.x1, box.y1);
+        graphics_draw_list_resolve(box.x2, box.y2);
+
+        if (box.x1 > box.x2)
+            std::swap(box.x1, box.x2);
+        if (box.y1 > box.y2)
+            std::swap(box.y1, box.y2);
+
+        // clip to the view, fast_boxfill() then only deals with spans that are on the page
+        box.x1 = std::max(box.x1, write_page->view_x1);
+        box.y1 = std::max(box.y1, write_page->view_y1);
+        box.x2 = std::min(box.x2, write_page->view_x2);
+        box.y2 = std::min(box.y2, write_page->view_y2);
+
+        if (box.x1 > box.x2 || box.y1 > box.y2)
+            continue;
+
+        fast_boxfill(box.x1, box.y1, box.x2, box.y2, box.color);
+    }
+}
@@ -0,0 +1,206 @@
+
+#include "libqb-common.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <atomic>
+#include <list>
+#include <string>
+#include <optional>
+
+#include "datetime.h"
+#include "logging.h"
+#include "logging_private.h"
+
+// The ring is a bounded multi-producer queue (Dmitry Vyukov's design): each
+// slot carries a sequence number that tells producers when it is free and the
+// writer when it has been filled. Producers only ever contend on a single
+// compare-and-swap of 'enqueue_pos'.
+
+async_log_dispatcher::async_log_dispatcher(std::list<log_handler *> *handlers)
+    : handlers(handlers), enqueue_pos(0), dequeue_pos(0), dropped(0), dropped_reported(0), sleeping(false), stopped(false), stopping(false) {
+
+    ring = new slot[RING_SIZE];
+    for (size_t i = 0; i < RING_SIZE; i++)
+        ring[i].sequence.store(i, std::memory_order_relaxed);
+
+    for (auto handler : *handlers)
+        handler->set_batched();
+
+    lock = libqb_mutex_new();
+    wake = libqb_condvar_new();
+
+    thread = libqb_thread_new();
+    libqb_thread_start(thread, thread_main, this);
+}
+
+async_log_dispatcher::~async_log_dispatcher() {
+    stop();
+
+    libqb_thread_free(thread);
+    libqb_condvar_free(wake);
+    libqb_mutex_free(lock);
+
+    delete[] ring;
+}
+
+bool async_log_dispatcher::push(loglevel lvl, logscope scope, double timestamp, const char *file, const char *func, int line, const char *fmt, va_list args, std::string *stacktrace) {
+    if (stopped.load(std::memory_order_acquire))
+        return false;
+
+    size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    slot *s;
+
+    for (;;) {
+        s = &ring[pos & (RING_SIZE - 1)];
+        size_t seq = s->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            // Full, the writer is behind. Never wait for it
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            delete stacktrace;
+            return true;
+        } else {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    s->level = lvl;
+    s->scope = scope;
+    s->timestamp = timestamp;
+    s->file = file;
+    s->func = func;
+    s->line = line;
+    s->stacktrace = stacktrace;
+    vsnprintf(s->message, sizeof(s->message), fmt, args);
+
+    s->sequence.store(pos + 1, std::memory_order_release);
+
+    // Pairs with the fence in run(). Only an idle writer needs a wake up, so
+    // the lock is taken at most once per batch rather than once per entry.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping.load(std::memory_order_relaxed) && sleeping.exchange(false)) {
+        libqb_mutex_guard guard(lock);
+        libqb_condvar_signal(wake);
+    }
+
+    return true;
+}
+
+// Only called from the writer thread
+bool async_log_dispatcher::pop(struct log_entry *entry) {
+    slot *s = &ring[dequeue_pos & (RING_SIZE - 1)];
+
+    if (s->sequence.load(std::memory_order_acquire) != dequeue_pos + 1)
+        return false;
+
+    entry->level = s->level;
+    entry->scope = s->scope;
+    entry->timestamp = s->timestamp;
+    entry->file = s->file;
+    entry->line = s->line;
+    entry->message = s->message;
+
+    std::optional<std::string> qb64_sym = libqb_log_resolve_qb64_symbol(s->func);
+    if (qb64_sym.has_value())
+        entry->func = *qb64_sym;
+    else
+        entry->func = s->func;
+
+    if (s->stacktrace) {
+        entry->stacktrace = std::move(*s->stacktrace);
+        delete s->stacktrace;
+    } else {
+        entry->stacktrace.clear();
+    }
+
+    s->sequence.store(dequeue_pos + RING_SIZE, std::memory_order_release);
+    dequeue_pos++;
+
+    return true;
+}
+
+void async_log_dispatcher::write_batch() {
+    struct log_entry entry;
+    size_t count = 0;
+
+    while (pop(&entry)) {
+        for (auto handler : *handlers)
+            handler->write(&entry);
+
+        count++;
+    }
+
+    uint64_t drops = dropped.load(std::memory_order_relaxed);
+    if (drops != dropped_reported) {
+        char msg[100];
+        snprintf(msg, sizeof(msg), "%llu log entries were dropped because the log queue was full", (unsigned long long)(drops - dropped_reported));
+        dropped_reported = drops;
+
+        entry.level = loglevel::Warning;
+        entry.scope = logscope::Runtime;
+        entry.timestamp = (double)GetTicks() / 1000;
+        entry.file = __FILE__;
+        entry.func = __func__;
+        entry.line = __LINE__;
+        entry.message = msg;
+        entry.stacktrace.clear();
+
+        for (auto handler : *handlers)
+            handler->write(&entry);
+
+        count++;
+    }
+
+    if (count) {
+        for (auto handler : *handlers)
+            handler->flush();
+    }
+}
+
+void async_log_dispatcher::run() {
+    for (;;) {
+        write_batch();
+
+        libqb_mutex_guard guard(lock);
+
+        sleeping.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Something may have been queued after write_batch() finished
+        if (ring[dequeue_pos & (RING_SIZE - 1)].sequence.load(std::memory_order_acquire) == dequeue_pos + 1) {
+            sleeping.store(false);
+            continue;
+        }
+
+        if (stopping)
+            break;
+
+        libqb_condvar_wait(wake, lock);
+        sleeping.store(false);
+    }
+
+    write_batch();
+}
+
+void async_log_dispatcher::thread_main(void *arg) {
+    static_cast<async_log_dispatcher *>(arg)->run();
+}
+
+void async_log_dispatcher::stop() {
+    if (stopped.exchange(true))
+        return;
+
+    {
+        libqb_mutex_guard guard(lock);
+        stopping = true;
+        libqb_condvar_signal(wake);
+    }
+
+    libqb_thread_join(thread);
+}
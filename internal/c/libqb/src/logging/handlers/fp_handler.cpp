@@ -39,8 +39,19 @@ void fp_log_writer::write(struct log_entry *entry) {
     if (entry->stacktrace != "")
         fprintf(fp, "%s", entry->stacktrace.c_str());
 
-    // Make sure buffers are written out immediately
-    fflush(fp);
+    // Make sure buffers are written out immediately, unless the async writer
+    // is going to flush the whole batch
+    if (!batched)
+        fflush(fp);
+}
+
+void fp_log_writer::flush() {
+    if (fp)
+        fflush(fp);
+}
+
+void fp_log_writer::set_batched() {
+    batched = true;
 }
 
 console_log_handler::console_log_handler() {
@@ -54,3 +65,11 @@ file_log_handler::file_log_handler() {
     if (!fp)
         fprintf(stderr, "Unable to open file '%s' for logging!", filepath);
 }
+
+void file_log_handler::set_batched() {
+    fp_log_writer::set_batched();
+
+    // Let a whole batch collect in the buffer so it goes out in one write
+    if (fp)
+        setvbuf(fp, NULL, _IOFBF, 64 * 1024);
+}
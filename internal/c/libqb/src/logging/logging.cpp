@@ -23,6 +23,7 @@
 
 static libqb_mutex *logging_lock;
 static std::list<log_handler *> handlers;
+static async_log_dispatcher *async_dispatcher;
 static loglevel minimum_level = loglevel::Information;
 
 // Short-circuits the logging logic if no handlers are enabled
@@ -83,10 +84,30 @@ static void libqb_vlog(loglevel lvl, logscope scope, const char *file, const cha
     if (minimum_level > lvl)
         return;
 
+    double timestamp = (double)GetTicks() / 1000; // Convert ms to number of seconds
+
+    // The async writer resolves the symbol and formats the output on its own
+    // thread, only the message itself has to be formatted here
+    if (async_dispatcher) {
+        std::string *stacktrace = nullptr;
+        if (lvl == loglevel::Error)
+            stacktrace = new std::string(libqb_log_get_stacktrace(qb64_only));
+
+        va_list args_copy;
+        va_copy(args_copy, args);
+        bool queued = async_dispatcher->push(lvl, scope, timestamp, file, func, line, fmt, args_copy, stacktrace);
+        va_end(args_copy);
+
+        if (queued)
+            return;
+
+        delete stacktrace; // The writer has stopped (program is exiting), write it out here instead
+    }
+
     struct log_entry entry;
     entry.level = lvl;
     entry.scope = scope;
-    entry.timestamp = (double)GetTicks() / 1000; // Convert ms to number of seconds
+    entry.timestamp = timestamp;
     entry.file = file;
 
     std::optional<std::string> qb64_sym = libqb_log_resolve_qb64_symbol(func);
@@ -128,6 +149,12 @@ void libqb_log_qbs(loglevel lvl, logscope scope, const char *file, const char *f
     libqb_log_qb64(lvl, scope, file, func, line, "%.*s", (int)str->len, (const char *)str->chr);
 }
 
+// Flushes the async writer when the program exits. The dispatcher itself is
+// left alive, as other threads may still be logging.
+static void libqb_log_async_stop() {
+    async_dispatcher->stop();
+}
+
 void libqb_log_init() {
     logging_lock = libqb_mutex_new();
 
@@ -138,18 +165,28 @@ void libqb_log_init() {
     std::stringstream stream(handler_cstr);
     std::string handler;
 
+    bool async = false;
+
     while (std::getline(stream, handler, ',')) {
         std::transform(handler.begin(), handler.end(), handler.begin(), ::tolower);
         if (handler == "console") {
             handlers.push_back(new console_log_handler());
         } else if (handler == "file") {
             handlers.push_back(new file_log_handler());
+        } else if (handler == "async") {
+            async = true;
         }
     }
 
-    if (handlers.size())
+    if (handlers.size()) {
         logging_enabled = true;
 
+        if (async) {
+            async_dispatcher = new async_log_dispatcher(&handlers);
+            atexit(libqb_log_async_stop);
+        }
+    }
+
     const char *scope_cstr = getenv("QB64PE_LOG_SCOPES");
     if (scope_cstr) {
         std::stringstream stream(scope_cstr);
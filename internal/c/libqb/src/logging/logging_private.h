@@ -1,8 +1,15 @@
 #pragma once
 
+#include <atomic>
+#include <list>
 #include <string>
 #include <optional>
+#include <stdarg.h>
+#include <stdio.h>
+#include "condvar.h"
 #include "logging.h"
+#include "mutex.h"
+#include "thread.h"
 
 #define runtime_log_trace(...) \
     libqb_log_with_scope_trace(logscope::Runtime, __VA_ARGS__)
@@ -32,6 +39,13 @@ struct log_entry {
 class log_handler {
   public:
     virtual void write(struct log_entry *) = 0;
+
+    // Called after a batch of entries has been written by the async writer
+    virtual void flush() { }
+
+    // Called once before the async writer takes over. Handlers can stop
+    // flushing after every entry and rely on flush() instead.
+    virtual void set_batched() { }
 };
 
 
@@ -48,9 +62,12 @@ std::string libqb_log_resolve_symbol(const void *address);
 class fp_log_writer : public log_handler {
   protected:
     FILE *fp;
+    bool batched = false;
 
   public:
     virtual void write(struct log_entry *entry);
+    virtual void flush();
+    virtual void set_batched();
 };
 
 class console_log_handler : public fp_log_writer {
@@ -61,4 +78,61 @@ class console_log_handler : public fp_log_writer {
 class file_log_handler : public fp_log_writer {
   public:
     file_log_handler();
+    virtual void set_batched();
+};
+
+// Hands entries to a background thread through a lock-free ring buffer so
+// that logging never formats output or touches files on the calling thread.
+// Enabled by adding 'async' to QB64PE_LOG_HANDLERS.
+class async_log_dispatcher {
+  public:
+    async_log_dispatcher(std::list<log_handler *> *handlers);
+    ~async_log_dispatcher();
+
+    // Queues an entry. This never waits for the writer thread; if the ring is
+    // full the entry is dropped and counted instead. Returns false if the
+    // writer has been stopped, in which case the caller has to write the
+    // entry itself.
+    bool push(loglevel lvl, logscope scope, double timestamp, const char *file, const char *func, int line, const char *fmt, va_list args,
+              std::string *stacktrace);
+
+    // Writes out everything that is still queued and stops the writer thread
+    void stop();
+
+  private:
+    static constexpr size_t RING_SIZE = 2048; // must be a power of two
+    static constexpr size_t MESSAGE_MAX = 200;
+
+    struct slot {
+        std::atomic<size_t> sequence;
+
+        loglevel level;
+        logscope scope;
+        double timestamp;
+        const char *file;
+        const char *func; // always a string literal, resolved on the writer thread
+        int line;
+        std::string *stacktrace; // only errors have one
+        char message[MESSAGE_MAX];
+    };
+
+    bool pop(struct log_entry *entry);
+    void write_batch();
+    void run();
+    static void thread_main(void *arg);
+
+    std::list<log_handler *> *handlers;
+    slot *ring;
+
+    std::atomic<size_t> enqueue_pos;
+    size_t dequeue_pos;
+    std::atomic<uint64_t> dropped;
+    uint64_t dropped_reported;
+
+    std::atomic<bool> sleeping;
+    std::atomic<bool> stopped;
+    bool stopping;
+    libqb_mutex *lock;
+    libqb_condvar *wake;
+    libqb_thread *thread;
 };
@@ -61,3 +61,7 @@ const char *libqb_http_get_url(int handle) {
     (void)handle;
     return NULL;
 }
+
+void libqb_http_get_stats(struct libqb_http_stats *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
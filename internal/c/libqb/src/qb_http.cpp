@@ -7,6 +7,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <unordered_map>
+#include <vector>
 
 #include "buffer.h"
 #include "completion.h"
@@ -39,6 +40,12 @@ struct handle {
 
     int status_code = -1;
 
+    // Set when the download was paused because too much data is waiting to be read
+    bool paused = false;
+
+    // Largest fixed length read that couldn't be satisfied, the download isn't paused until it can be
+    size_t wanted = 0;
+
     handle() {
         io_lock = libqb_mutex_new();
         libqb_buffer_init(&out);
@@ -68,19 +75,41 @@ struct close_handle {
     struct completion closed;
 };
 
+// Maximum number of finished easy handles kept around for reuse
+#define CURL_IDLE_HANDLES_MAX 8
+
+// A download is paused once this much data is waiting for the program to read it, and continues once the program
+// has read it back down to the low-water mark. This keeps memory bounded when the program reads slowly.
+#define HTTP_BUFFER_HIGH_WATER (4 * 1024 * 1024)
+#define HTTP_BUFFER_LOW_WATER  (1 * 1024 * 1024)
+
 struct curl_state {
     CURLM *multi;
 
+    // Shares the DNS cache, TLS sessions and connection cache between all of our easy handles, so a request to a
+    // server we recently talked to can skip the lookup and handshakes. Each kind of data gets its own lock.
+    CURLSH *share;
+    struct libqb_mutex *share_locks[CURL_LOCK_DATA_LAST];
+
     // Lock protects all the below members
     struct libqb_mutex *lock;
 
     struct std::unordered_map<int, struct handle *> handle_table;
     std::queue<struct add_handle *> add_handle_queue;
     std::queue<struct close_handle *> close_handle_queue;
+    std::queue<int> resume_handle_queue; // paused handles the program has made room for
     int stop_curl;
 
+    // Easy handles from finished requests, curl_easy_reset() keeps their caches so they're cheaper than new ones
+    std::vector<CURL *> idle_handles;
+
+    struct libqb_http_stats stats;
+
     curl_state() {
         lock = libqb_mutex_new();
+
+        for (int i = 0; i < CURL_LOCK_DATA_LAST; i++)
+            share_locks[i] = libqb_mutex_new();
     }
 };
 
@@ -132,6 +161,54 @@ static void __fillout_curl_info(struct handle *handle) {
     }
 }
 
+static void curl_share_lock(CURL *con, curl_lock_data data, curl_lock_access access, void *userptr) {
+    (void)con;
+    (void)access;
+
+    libqb_mutex_lock(((struct curl_state *)userptr)->share_locks[data]);
+}
+
+static void curl_share_unlock(CURL *con, curl_lock_data data, void *userptr) {
+    (void)con;
+
+    libqb_mutex_unlock(((struct curl_state *)userptr)->share_locks[data]);
+}
+
+// Gets an easy handle for a new request, reusing a finished one if we have any
+static CURL *acquire_easy_handle(struct curl_state *state) {
+    CURL *con = NULL;
+
+    {
+        libqb_mutex_guard guard(state->lock);
+
+        if (!state->idle_handles.empty()) {
+            con = state->idle_handles.back();
+            state->idle_handles.pop_back();
+        }
+    }
+
+    if (con)
+        curl_easy_reset(con); // also clears the share, the caller sets all options again
+    else
+        con = curl_easy_init();
+
+    return con;
+}
+
+// Returns an easy handle that's no longer attached to the multi handle
+static void release_easy_handle(struct curl_state *state, CURL *con) {
+    {
+        libqb_mutex_guard guard(state->lock);
+
+        if (state->idle_handles.size() < CURL_IDLE_HANDLES_MAX) {
+            state->idle_handles.push_back(con);
+            return;
+        }
+    }
+
+    curl_easy_cleanup(con);
+}
+
 // Processes the handle addition and deletion lists
 static void process_handles(struct curl_state *state) {
     std::list<CURL *> connectionsToDrop;
@@ -148,6 +225,14 @@ static void process_handles(struct curl_state *state) {
             completion_finish(&add->added);
         }
 
+        for (; !state->resume_handle_queue.empty(); state->resume_handle_queue.pop()) {
+            auto it = state->handle_table.find(state->resume_handle_queue.front());
+
+            // This can run the write callback right away, that's fine since it only takes the handle's io_lock
+            if (it != state->handle_table.end() && it->second->con)
+                curl_easy_pause(it->second->con, CURLPAUSE_CONT);
+        }
+
         for (; !state->close_handle_queue.empty(); state->close_handle_queue.pop()) {
             struct close_handle *close = state->close_handle_queue.front();
             struct handle *handle = state->handle_table[close->handle];
@@ -169,7 +254,7 @@ static void process_handles(struct curl_state *state) {
         // that we have to call it without holding the lock, or we could
         // deadlock.
         curl_multi_remove_handle(state->multi, con);
-        curl_easy_cleanup(con);
+        curl_easy_cleanup(con); // unfinished, possibly paused, so it's not worth keeping
     }
 }
 
@@ -207,8 +292,21 @@ static void handle_messages(struct curl_state *state) {
             }
         }
 
+        // NUM_CONNECTS is the number of new connections this request had to make, zero means it reused one
+        long connects = 0;
+        curl_easy_getinfo(e, CURLINFO_NUM_CONNECTS, &connects);
+
+        {
+            libqb_mutex_guard guard(state->lock);
+
+            state->stats.requests++;
+            state->stats.connections += connects;
+            if (!connects && msg->data.result == CURLE_OK)
+                state->stats.reused_connections++;
+        }
+
         curl_multi_remove_handle(state->multi, e);
-        curl_easy_cleanup(e);
+        release_easy_handle(state, e);
     }
 }
 
@@ -265,6 +363,13 @@ static void libqb_curl_thread_handler(void *arg) {
 
     // FIXME: This should do graceful closing for uploads, but because we only support
     // downloads at the moment throwing the data away doesn't matter.
+
+    libqb_mutex_guard guard(state->lock);
+
+    for (CURL *con : state->idle_handles)
+        curl_easy_cleanup(con);
+
+    state->idle_handles.clear();
 }
 
 static struct curl_state curl_state;
@@ -277,12 +382,20 @@ static size_t receive_http_block(void *ptr, size_t size, size_t nmemb, void *dat
 
     libqb_mutex_guard guard(handle->io_lock);
 
-    libqb_buffer_write(&handle->out, (const char *)ptr, length);
-
     // The first time this connection starts to receive data we fill out the
     // connection info.
     __fillout_curl_info(handle);
 
+    // Too much is waiting to be read, curl will hand us this block again once the download is continued
+    size_t buffered = libqb_buffer_length(&handle->out);
+
+    if (buffered >= HTTP_BUFFER_HIGH_WATER && buffered >= handle->wanted) {
+        handle->paused = true;
+        return CURL_WRITEFUNC_PAUSE;
+    }
+
+    libqb_buffer_write(&handle->out, (const char *)ptr, length);
+
     return length;
 }
 
@@ -290,6 +403,28 @@ static bool is_valid_http_id(int id) {
     return curl_state.handle_table.find(id) != curl_state.handle_table.end();
 }
 
+// Checks whether a paused download has room to continue after the program read from it.
+//
+// Handle should be locked when calling this function, the resume itself is requested by resume_handle() after
+// unlocking it
+static bool __should_resume(struct handle *handle) {
+    if (!handle->paused || libqb_buffer_length(&handle->out) > HTTP_BUFFER_LOW_WATER)
+        return false;
+
+    handle->paused = false;
+    return true;
+}
+
+static void resume_handle(struct handle *handle) {
+    {
+        libqb_mutex_guard guard(curl_state.lock);
+
+        curl_state.resume_handle_queue.push(handle->id);
+    }
+
+    curl_state_wakeup(&curl_state);
+}
+
 int libqb_http_get_length(int id, size_t *length) {
     if (!is_valid_http_id(id))
         return -1;
@@ -376,10 +511,17 @@ int libqb_http_get(int id, char *buf, size_t *length) {
         return -1;
 
     struct handle *handle = curl_state.handle_table[id];
+    bool resume;
 
-    libqb_mutex_guard guard(handle->io_lock);
+    {
+        libqb_mutex_guard guard(handle->io_lock);
 
-    *length = libqb_buffer_read(&handle->out, buf, *length);
+        *length = libqb_buffer_read(&handle->out, buf, *length);
+        resume = __should_resume(handle);
+    }
+
+    if (resume)
+        resume_handle(handle);
 
     return 0;
 }
@@ -389,16 +531,34 @@ int libqb_http_get_fixed(int id, char *buf, size_t length) {
         return -1;
 
     struct handle *handle = curl_state.handle_table[id];
+    size_t total_length;
+    bool resume;
 
-    libqb_mutex_guard guard(handle->io_lock);
+    {
+        libqb_mutex_guard guard(handle->io_lock);
+
+        total_length = libqb_buffer_length(&handle->out);
 
-    size_t total_length = libqb_buffer_length(&handle->out);
+        if (total_length < length) {
+            // Make sure the download isn't held up waiting for us when we need more than the high-water mark
+            if (length > handle->wanted)
+                handle->wanted = length;
+
+            resume = handle->paused;
+            handle->paused = false;
+        } else {
+            libqb_buffer_read(&handle->out, buf, length);
+            handle->wanted = 0;
+            resume = __should_resume(handle);
+        }
+    }
+
+    if (resume)
+        resume_handle(handle);
 
     if (total_length < length)
         return -1;
 
-    libqb_buffer_read(&handle->out, buf, length);
-
     return 0;
 }
 
@@ -418,9 +578,10 @@ int libqb_http_open(const char *url, int id) {
 
     handle->id = id;
 
-    handle->con = curl_easy_init();
+    handle->con = acquire_easy_handle(&curl_state);
     curl_easy_setopt(handle->con, CURLOPT_PRIVATE, handle);
     curl_easy_setopt(handle->con, CURLOPT_URL, url);
+    curl_easy_setopt(handle->con, CURLOPT_SHARE, curl_state.share);
 
     // This is a temporary solution and should be moved to the BASIC level as
     // soon as GitHub Issue #619 is properly implemented. We may use this to
@@ -506,11 +667,27 @@ int libqb_http_close(int id) {
     return 0;
 }
 
+void libqb_http_get_stats(struct libqb_http_stats *stats) {
+    libqb_mutex_guard guard(curl_state.lock);
+
+    *stats = curl_state.stats;
+}
+
 void libqb_http_init() {
     curl_global_init(CURL_GLOBAL_DEFAULT);
 
     curl_state.multi = curl_multi_init();
 
+    curl_state.share = curl_share_init();
+    curl_share_setopt(curl_state.share, CURLSHOPT_LOCKFUNC, curl_share_lock);
+    curl_share_setopt(curl_state.share, CURLSHOPT_UNLOCKFUNC, curl_share_unlock);
+    curl_share_setopt(curl_state.share, CURLSHOPT_USERDATA, &curl_state);
+    curl_share_setopt(curl_state.share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(curl_state.share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if CURL_AT_LEAST_VERSION(7, 57, 0)
+    curl_share_setopt(curl_state.share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+
     curl_thread = libqb_thread_new();
     libqb_thread_start(curl_thread, libqb_curl_thread_handler, &curl_state);
 }
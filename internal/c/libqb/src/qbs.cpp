@@ -80,6 +80,7 @@ static uint32_t qbs_data_size = 1048576;
 static uint32_t qbs_sp = 0;
 
 void qbs_free(qbs *str) {
+    qbs *tqbs;
 
     if (str->field)
         field_free(str);
@@ -105,7 +106,8 @@ void qbs_free(qbs *str) {
                 goto retry;
         }
         if (qbs_list_nexti) {
-            qbs_sp = ((qbs *)qbs_list[qbs_list_nexti - 1])->chr - qbs_data + ((qbs *)qbs_list[qbs_list_nexti - 1])->len + 32;
+            tqbs = (qbs *)qbs_list[qbs_list_nexti - 1];
+            qbs_sp = tqbs->chr - qbs_data + std::max(tqbs->len, tqbs->capacity) + 32;
             if (qbs_sp > qbs_data_size)
                 qbs_sp = qbs_data_size; // adding 32 could overflow buffer!
         } else {
@@ -160,6 +162,7 @@ static void qbs_concat(uint32_t bytesrequired) {
         for (i = 0; i < qbs_list_nexti; i++) {
             if (qbs_list[i] != -1) {
                 tqbs = (qbs *)qbs_list[i];
+                tqbs->capacity = 0; // reservations do not survive compaction
                 if ((tqbs->chr - dest) > 32) {
                     if (tqbs->len) {
                         memmove(dest, tqbs->chr, tqbs->len);
@@ -318,6 +321,7 @@ qbs *qbs_set(qbs *deststr, qbs *srcstr) {
 
         deststr->chr = srcstr->chr;
         deststr->len = srcstr->len;
+        deststr->capacity = 0;
         qbs_free_descriptor(srcstr);
 
         return deststr; // nb. This return cannot be changed to a goto qbs_set_return!
@@ -341,6 +345,7 @@ qbs *qbs_set(qbs *deststr, qbs *srcstr) {
         if (((intptr_t)deststr->chr + srcstr->len) <= ((intptr_t)qbs_data + (intptr_t)qbs_data_size)) { // space available
             memcpy(deststr->chr, srcstr->chr, srcstr->len);
             deststr->len = srcstr->len;
+            deststr->capacity = 0;
             qbs_sp = ((intptr_t)deststr->chr) + (intptr_t)deststr->len - (intptr_t)qbs_data;
             goto qbs_set_return;
         }
@@ -371,6 +376,7 @@ skippedtmpsrcindex2:
     if (((intptr_t)deststr->chr + srcstr->len) <= ((intptr_t)qbs_data + (intptr_t)qbs_data_size)) { // space available
         memmove(deststr->chr, srcstr->chr, srcstr->len); // overlap possible due to sometimes acquiring srcstr's space
         deststr->len = srcstr->len;
+        deststr->capacity = 0;
         qbs_sp = ((intptr_t)deststr->chr) + (intptr_t)deststr->len - (intptr_t)qbs_data;
         goto qbs_set_return;
     }
@@ -390,6 +396,7 @@ qbs_set_concat_required:
 
     deststr->chr = qbs_data + qbs_sp;
     deststr->len = srcstr->len;
+    deststr->capacity = 0;
     qbs_sp += deststr->len;
     memcpy(deststr->chr, srcstr->chr, srcstr->len);
 
@@ -402,6 +409,85 @@ qbs_set_return:
     return deststr;
 }
 
+// the most bytes qbs_append() reserves beyond a string's length
+static const int32_t qbs_append_max_reserve = 16777216;
+
+// deststr = deststr + srcstr
+// Unlike qbs_set(deststr, qbs_add(deststr, srcstr)) this extends deststr where it lies when the bytes
+// after it are unused. When deststr has to move it is given room to grow, so s$ = s$ + x$ in a loop
+// runs in amortized linear time instead of copying the whole string on every iteration.
+qbs *qbs_append(qbs *deststr, qbs *srcstr) {
+    uint32_t i;
+    qbs *tqbs;
+
+    if (deststr->fixed || deststr->readonly || deststr->in_cmem || deststr->field || deststr == srcstr)
+        return qbs_set(deststr, qbs_add(deststr, srcstr));
+
+    if (!srcstr->len)
+        goto qbs_append_return;
+
+    {
+        int64_t newlen = (int64_t)deststr->len + srcstr->len;
+        int64_t reserve = newlen + std::min<int64_t>(newlen, qbs_append_max_reserve);
+        uint8_t *limit = qbs_data + qbs_data_size;
+        bool last = true;
+
+        if (newlen > INT32_MAX)
+            return qbs_set(deststr, qbs_add(deststr, srcstr));
+
+        // locate the next valid index, a tmp srcstr will be freed so its space can be used
+        for (i = deststr->listi + 1; i < qbs_list_nexti; i++) {
+            if (qbs_list[i] != -1) {
+                tqbs = (qbs *)qbs_list[i];
+                if (tqbs == srcstr && srcstr->tmp)
+                    continue;
+                limit = tqbs->chr;
+                last = false;
+                break;
+            }
+        }
+
+        if (deststr->chr + newlen <= limit) { // space available
+            memmove(deststr->chr + deststr->len, srcstr->chr, srcstr->len);
+            deststr->len = newlen;
+            if (last) {
+                // reserve the space that follows so later strings are created beyond it
+                if (deststr->capacity < newlen)
+                    deststr->capacity = std::min<int64_t>(reserve, qbs_data + qbs_data_size - deststr->chr);
+                qbs_sp = deststr->chr - qbs_data + deststr->capacity;
+            }
+            goto qbs_append_return;
+        }
+
+        //"realloc" deststr
+        if (reserve > INT32_MAX)
+            reserve = newlen;
+        if ((qbs_sp + reserve + 32) > qbs_data_size)
+            qbs_concat(reserve + 32); // srcstr and deststr are still listed so their ->chr pointers are kept up to date
+        memcpy(qbs_data + qbs_sp, deststr->chr, deststr->len);
+        memcpy(qbs_data + qbs_sp + deststr->len, srcstr->chr, srcstr->len);
+
+        qbs_list[deststr->listi] = -1; // unlist
+        if (qbs_list_nexti > qbs_list_lasti)
+            qbs_concat_list();
+        deststr->listi = qbs_list_nexti;
+        qbs_list[qbs_list_nexti] = (intptr_t)deststr;
+        qbs_list_nexti++; // relist
+
+        deststr->chr = qbs_data + qbs_sp;
+        deststr->len = newlen;
+        deststr->capacity = reserve;
+        qbs_sp += reserve;
+    }
+
+qbs_append_return:
+    if (srcstr->tmp) { // remove srcstr if it is a tmp string
+        qbs_free(srcstr);
+    }
+
+    return deststr;
+}
+
 qbs *qbs_add(qbs *str1, qbs *str2) {
     qbs *tqbs;
     if (!str2->len)
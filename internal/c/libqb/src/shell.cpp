@@ -11,8 +11,10 @@
 #endif
 
 #include "command.h"
+#include "console.h"
 #include "datetime.h"
 #include "error_handle.h"
+#include "gfs.h"
 #include "qbs.h"
 #include "shell.h"
 
@@ -22,6 +24,12 @@ extern int32_t console_active;
 
 int32_t shell_call_in_progress = 0;
 
+// buffered file and console output is handed to the OS first, so the child process sees everything written so far
+static void shell_flush_files() {
+    gfs_flush_all_files();
+    console_output_flush();
+}
+
 #ifdef QB64_WINDOWS
 static int32_t cmd_available = -1;
 
@@ -172,6 +180,8 @@ int64_t func_shell(qbs *str) {
     if (is_error_pending())
         return 1;
 
+    shell_flush_files();
+
     int64_t return_code = 0;
 
     // exit full screen mode if necessary
@@ -461,6 +471,8 @@ int64_t func__shellhide(qbs *str) { // func _SHELLHIDE(...
     if (is_error_pending())
         return 1;
 
+    shell_flush_files();
+
     static int64_t return_code;
     return_code = 0;
 
@@ -674,6 +686,8 @@ void sub_shell(qbs *str, int32_t passed) {
     if (is_error_pending())
         return;
 
+    shell_flush_files();
+
     // exit full screen mode if necessary
     static int32_t full_screen_mode;
     full_screen_mode = full_screen;
@@ -954,6 +968,8 @@ void sub_shell2(qbs *str, int32_t passed) { // HIDE
     if (is_error_pending())
         return;
 
+    shell_flush_files();
+
     if (passed & 1) {
         sub_shell4(str, passed & 2);
         return;
@@ -1166,6 +1182,8 @@ void sub_shell3(qbs *str, int32_t passed) { //_DONTWAIT
     if (is_error_pending())
         return;
 
+    shell_flush_files();
+
     if (passed & 1) {
         sub_shell4(str, passed & 2);
         return;
@@ -1357,6 +1375,8 @@ void sub_shell4(qbs *str, int32_t passed) { //_DONTWAIT & _HIDE
         return;
     } // should not hide a shell waiting for input
 
+    shell_flush_files();
+
     static qbs *strz = NULL;
     static qbs *str1 = NULL;
     static qbs *str2 = NULL;
@@ -1,10 +1,13 @@
 
 #include "libqb-common.h"
 
+#include <errno.h>
 #include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
+#include "condvar.h"
 #include "mutex.h"
 
 struct libqb_thread {
@@ -40,7 +43,19 @@ void libqb_mutex_unlock(struct libqb_mutex *m) {
 
 struct libqb_condvar *libqb_condvar_new() {
     struct libqb_condvar *c = (struct libqb_condvar *)malloc(sizeof(*c));
+
+#ifdef QB64_MACOSX
     pthread_cond_init(&c->var, NULL);
+#else
+    // Timed waits are measured against the monotonic clock, so changing the
+    // system time does not affect them
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&c->var, &attr);
+    pthread_condattr_destroy(&attr);
+#endif
+
     return c;
 }
 
@@ -53,6 +68,28 @@ void libqb_condvar_wait(struct libqb_condvar *condvar, struct libqb_mutex *mutex
     pthread_cond_wait(&condvar->var, &mutex->mtx);
 }
 
+bool libqb_condvar_wait_for(struct libqb_condvar *condvar, struct libqb_mutex *mutex, uint64_t microseconds) {
+    struct timespec ts;
+
+#ifdef QB64_MACOSX
+    ts.tv_sec = microseconds / 1000000;
+    ts.tv_nsec = (microseconds % 1000000) * 1000;
+
+    return pthread_cond_timedwait_relative_np(&condvar->var, &mutex->mtx, &ts) != ETIMEDOUT;
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    ts.tv_sec += microseconds / 1000000;
+    ts.tv_nsec += (microseconds % 1000000) * 1000;
+    if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+
+    return pthread_cond_timedwait(&condvar->var, &mutex->mtx, &ts) != ETIMEDOUT;
+#endif
+}
+
 void libqb_condvar_signal(struct libqb_condvar *condvar) {
     pthread_cond_signal(&condvar->var);
 }
@@ -56,6 +56,18 @@ void libqb_condvar_wait(struct libqb_condvar *condvar, struct libqb_mutex *mutex
     SleepConditionVariableCS(&condvar->var, &mutex->crit_section, INFINITE);
 }
 
+bool libqb_condvar_wait_for(struct libqb_condvar *condvar, struct libqb_mutex *mutex, uint64_t microseconds) {
+    // Rounded up, waking early would just mean another wait
+    uint64_t milliseconds = (microseconds + 999) / 1000;
+    if (milliseconds >= INFINITE)
+        milliseconds = INFINITE - 1;
+
+    if (SleepConditionVariableCS(&condvar->var, &mutex->crit_section, (DWORD)milliseconds))
+        return true;
+
+    return GetLastError() != ERROR_TIMEOUT;
+}
+
 void libqb_condvar_signal(struct libqb_condvar *condvar) {
     WakeConditionVariable(&condvar->var);
 }
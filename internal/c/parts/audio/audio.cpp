@@ -19,8 +19,8 @@
 #include "filesystem.h"
 #include "framework.h"
 #include "memblock.h"
-#include "mutex.h"
 #include "qbs.h"
+#include "ring_queue.h"
 
 /// @brief The top-level class that implements the QB64-PE audio engine.
 class AudioEngine {
@@ -389,16 +389,15 @@ class AudioEngine {
         ma_engine *maEngine;                      // pointer to a ma_engine object that was passed while creating the data source
         ma_sound *maSound;                        // pointer to a ma_sound object that was passed while creating the data source
 
-        struct Buffer {                       // we'll give this a name that we'll use below
-            std::vector<SampleFrameF32> data; // this holds the actual sample frames
-            size_t cursor;                    // the read cursor (in frames) in the stream
-        } buffer[2];                          // we need two of these to do a proper ping-pong
+        libqb_ring_queue<SampleFrameF32> queue; // lock-free queue of sample frames from the main thread to the miniaudio thread
+        std::atomic<uint64_t> overruns;         // number of times the producer found the ring full and had to spill into the overflow vector
+        std::atomic<uint64_t> underruns;        // number of times the miniaudio thread ran out of frames while the stream was playing
+        bool starved;                           // consumer-side state used to count each underrun only once
+        std::atomic_bool stop;                  // set this to true to stop supply of samples completely (including silent samples)
+        std::atomic_bool pause_;                // set this to true to pause the stream (only silence samples will be sent to miniaudio)
 
-        Buffer *consumer;        // this is what the miniaudio thread will use to pull data from
-        Buffer *producer;        // this is what the main thread will use to push data to
-        libqb_mutex *m;          // we'll use a mutex to give exclusive access to resources used by both threads
-        bool stop;               // set this to true to stop supply of samples completely (including silent samples)
-        std::atomic_bool pause_; // set this to true to pause the stream (only silence samples will be sent to miniaudio)
+        /// @brief The ring holds this many seconds of audio before the producer starts spilling into the overflow vector.
+        static constexpr auto RING_SECONDS = 2u;
 
         // Delete default, copy and move constructors and assignments.
         RawStream() = delete;
@@ -407,21 +406,16 @@ class AudioEngine {
         RawStream &operator=(RawStream &&) = delete;
         RawStream(RawStream &&) = delete;
 
-        /// @brief Sets up the vectors, mutex and set some defaults.
-        RawStream(ma_engine *pmaEngine, ma_sound *pmaSound) {
-            maSound = pmaSound;                      // Save the pointer to the ma_sound object (this is basically from a QB64-PE sound handle)
-            maEngine = pmaEngine;                    // Save the pointer to the ma_engine object (this should come from the QB64-PE sound engine)
-            buffer[0].cursor = buffer[1].cursor = 0; // reset the cursors
-            consumer = &buffer[0];                   // set default consumer
-            producer = &buffer[1];                   // set default producer
-            stop = false;                            // we will send silent samples to keep the playback going by default
-            Pause(false);                            // the steam will not be paused by default
-            m = libqb_mutex_new();
-        }
+        /// @brief Sets up the queue and some defaults.
+        RawStream(ma_engine *pmaEngine, ma_sound *pmaSound) : queue(std::max<size_t>(size_t(ma_engine_get_sample_rate(pmaEngine)) * RING_SECONDS, 1024)) {
+            maSound = pmaSound;   // Save the pointer to the ma_sound object (this is basically from a QB64-PE sound handle)
+            maEngine = pmaEngine; // Save the pointer to the ma_engine object (this should come from the QB64-PE sound engine)
 
-        /// @brief We use this to destroy the mutex.
-        ~RawStream() {
-            libqb_mutex_free(m);
+            overruns.store(0, std::memory_order_relaxed);
+            underruns.store(0, std::memory_order_relaxed);
+            starved = true;                               // nothing has been played yet; an empty stream at startup is not an underrun
+            stop.store(false, std::memory_order_relaxed); // we will send silent samples to keep the playback going by default
+            Pause(false);                                 // the steam will not be paused by default
         }
 
         /// @brief Pauses or resumes the stream.
@@ -430,54 +424,51 @@ class AudioEngine {
             pause_.store(state, std::memory_order_relaxed);
         }
 
-        /// @brief Pushes a sample frame at the end of the queue. This is mutex protected and called by the main thread.
+        /// @brief Pushes frames at the end of the queue. This is called by the main thread only.
+        /// @param frames The number of frames to push.
+        /// @param frameAt A callable that returns the sample frame at a given index in [0, frames).
+        template <typename FrameFn> void Push(size_t frames, FrameFn &&frameAt) {
+            if (queue.push(frames, frameAt)) {
+                overruns.fetch_add(1, std::memory_order_relaxed); // count each time the queue outgrows the ring
+
+                audio_log_trace("Raw stream ring full (%zu frames); spilling to overflow", queue.capacity());
+            }
+        }
+
+        /// @brief Pushes a sample frame at the end of the queue. This is called by the main thread.
         /// @param l Sample frame left channel data.
         /// @param r Sample frame right channel data.
         void PushSampleFrame(float l, float r) {
-            libqb_mutex_guard lock(m); // lock the mutex before accessing the vectors
-
-            producer->data.push_back({l, r}); // push the sample frame to the back of the producer queue
+            Push(1, [l, r](size_t) { return SampleFrameF32{l, r}; });
         }
 
-        /// @brief Pushes a whole buffer of stereo sample frames to the queue. This is mutex protected and called by the main thread.
+        /// @brief Pushes a whole buffer of stereo sample frames to the queue. This is called by the main thread.
         /// @param buffer The buffer containing the stereo sample frames. This cannot be NULL.
         /// @param frames The total number of frames in the buffer.
         void PushSampleFrames(SampleFrameF32 *buffer, ma_uint64 frames) {
-            libqb_mutex_guard lock(m); // lock the mutex before accessing the vectors
-
-            std::copy(buffer, buffer + frames, std::back_inserter(producer->data));
+            Push(size_t(frames), [buffer](size_t i) { return buffer[i]; });
         }
 
-        /// @brief Pushes a whole buffer of mono sample frames to the queue. This is mutex protected and called by the main thread.
+        /// @brief Pushes a whole buffer of mono sample frames to the queue. This is called by the main thread.
         /// @param buffer The buffer containing the sample frames. This cannot be NULL.
         /// @param frames The total number of frames in the buffer.
         /// @param gainLeft Left channel gain value (0.0 to 1.0).
         /// @param gainRight Right channel gain value (0.0 to 1.0).
         void PushSampleFrames(float *buffer, ma_uint64 frames, float gainLeft, float gainRight) {
-            libqb_mutex_guard lock(m); // lock the mutex before accessing the vectors
-
-            for (ma_uint64 i = 0; i < frames; i++) {
-                producer->data.push_back({buffer[i] * gainLeft, buffer[i] * gainRight});
-            }
+            Push(size_t(frames), [buffer, gainLeft, gainRight](size_t i) { return SampleFrameF32{buffer[i] * gainLeft, buffer[i] * gainRight}; });
         }
 
-        /// @brief Pushes a whole buffer of mono sample frames to the queue (no FP panning math). This is mutex protected and called by the main thread.
+        /// @brief Pushes a whole buffer of mono sample frames to the queue (no FP panning math). This is called by the main thread.
         /// @param buffer The buffer containing the sample frames. This cannot be NULL.
         /// @param frames The total number of frames in the buffer.
         void PushSampleFrames(float *buffer, ma_uint64 frames) {
-            libqb_mutex_guard lock(m); // lock the mutex before accessing the vectors
-
-            for (ma_uint64 i = 0; i < frames; i++) {
-                producer->data.push_back({buffer[i], buffer[i]});
-            }
+            Push(size_t(frames), [buffer](size_t i) { return SampleFrameF32{buffer[i], buffer[i]}; });
         }
 
-        /// @brief Returns the length, in sample frames of sound queued.
+        /// @brief Returns the length, in sample frames of sound queued. This is called by the main thread.
         /// @return The length left to play in sample frames.
         ma_uint64 GetSampleFramesRemaining() {
-            libqb_mutex_guard lock(m); // lock the mutex before accessing the vectors
-
-            return (consumer->data.size() - consumer->cursor) + (producer->data.size() - producer->cursor); // sum of producer and consumer sample frames
+            return queue.size(); // sum of ring and overflow sample frames
         }
 
         /// @brief Returns the length, in seconds of sound queued.
@@ -487,6 +478,7 @@ class AudioEngine {
         }
 
         /// @brief Callback function used by miniaudio to pull a chunk of raw sample frames to play. The samples being read is removed from the queue.
+        /// This never blocks: the ring is lock-free and the overflow vector is only drained if its lock can be taken immediately.
         /// @param pDataSource Pointer to the raw stream data source (cast to RawStream type).
         /// @param pFramesOut The sample frames sent to miniaudio.
         /// @param frameCount The sample frame count requested by miniaudio.
@@ -516,33 +508,26 @@ class AudioEngine {
                 std::fill(maBuffer, maBuffer + frameCount, SampleFrameF32{SILENCE_SAMPLE_F32, SILENCE_SAMPLE_F32});
                 sampleFramesRead = frameCount;
             } else {
-                sampleFramesRead = pRawStream->consumer->data.size() - pRawStream->consumer->cursor; // total amount of samples we need to send to miniaudio
-
-                // Swap buffers if we do not have anything left to play
-                if (!sampleFramesRead) {
-                    pRawStream->consumer->cursor = 0;                                                    // reset the cursor
-                    pRawStream->consumer->data.clear();                                                  // clear the consumer vector
-                    std::swap(pRawStream->consumer, pRawStream->producer);                               // quickly swap the Buffer pointers
-                    sampleFramesRead = pRawStream->consumer->data.size() - pRawStream->consumer->cursor; // get the total number of samples again
-                }
-
-                sampleFramesRead = std::min(sampleFramesRead, frameCount); // we'll always send lower of what miniaudio wants or what we have
+                sampleFramesRead = pRawStream->queue.pop(maBuffer, size_t(frameCount)); // we'll always send lower of what miniaudio wants or what we have
 
-                if (sampleFramesRead) {
-                    // Now send the samples to miniaudio
-                    std::copy(pRawStream->consumer->data.data() + pRawStream->consumer->cursor,
-                              pRawStream->consumer->data.data() + pRawStream->consumer->cursor + sampleFramesRead, maBuffer);
+                if (sampleFramesRead < frameCount) {
+                    if (!pRawStream->starved) {
+                        pRawStream->starved = true;
+                        pRawStream->underruns.fetch_add(1, std::memory_order_relaxed); // count the transition from playing to starving only once
+                    }
 
-                    pRawStream->consumer->cursor += sampleFramesRead; // increment the read cursor
-                } else {
-                    if (pRawStream->stop) {
-                        // End of stream was signalled
-                        result = MA_AT_END;
-                    } else {
-                        // To keep the stream going, play silence if there are no frames to play
-                        std::fill(maBuffer, maBuffer + frameCount, SampleFrameF32{SILENCE_SAMPLE_F32, SILENCE_SAMPLE_F32});
-                        sampleFramesRead = frameCount;
+                    if (!sampleFramesRead) {
+                        if (pRawStream->stop.load(std::memory_order_relaxed) && !pRawStream->queue.spilling()) {
+                            // End of stream was signalled and everything was played
+                            result = MA_AT_END;
+                        } else {
+                            // To keep the stream going, play silence if there are no frames to play
+                            std::fill(maBuffer, maBuffer + frameCount, SampleFrameF32{SILENCE_SAMPLE_F32, SILENCE_SAMPLE_F32});
+                            sampleFramesRead = frameCount;
+                        }
                     }
+                } else {
+                    pRawStream->starved = false;
                 }
             }
 
@@ -3446,6 +3431,38 @@ class AudioEngine {
         return 0.0;
     }
 
+    /// @brief Returns the number of times a raw sound queue outgrew its ring buffer (i.e. the program pushed audio faster than it was played).
+    /// @param handle A sound handle.
+    /// @param passed Optional parameter flags.
+    /// @return The overrun count.
+    int64_t GetRawSoundOverruns(int32_t handle, int32_t passed) {
+        // Use the default raw handle if handle was not passed
+        if (!passed)
+            handle = internalSndRaw;
+
+        if (isInitialized && IsHandleValid(handle) && soundHandles[handle]->type == AudioEngine::SoundHandle::Type::RAW) {
+            return int64_t(soundHandles[handle]->rawStream->overruns.load(std::memory_order_relaxed));
+        }
+
+        return 0;
+    }
+
+    /// @brief Returns the number of times the audio device ran out of queued raw sound while playing (i.e. the program did not push audio fast enough).
+    /// @param handle A sound handle.
+    /// @param passed Optional parameter flags.
+    /// @return The underrun count.
+    int64_t GetRawSoundUnderruns(int32_t handle, int32_t passed) {
+        // Use the default raw handle if handle was not passed
+        if (!passed)
+            handle = internalSndRaw;
+
+        if (isInitialized && IsHandleValid(handle) && soundHandles[handle]->type == AudioEngine::SoundHandle::Type::RAW) {
+            return int64_t(soundHandles[handle]->rawStream->underruns.load(std::memory_order_relaxed));
+        }
+
+        return 0;
+    }
+
     /// @brief Returns a sound handle to a newly created sound's raw data in memory with the given specification. The user can then fill the buffer with
     /// whatever they want (using _MEMSOUND) and play it. This is basically the sound equivalent of _NEWIMAGE.
     /// @param frames The number of sample frames required.
@@ -3894,6 +3911,14 @@ double func__sndrawlen(int32_t handle, int32_t passed) {
     return AudioEngine::Instance().GetRawSoundTimeRemaining(handle, passed);
 }
 
+int64_t func__sndrawoverruns(int32_t handle, int32_t passed) {
+    return AudioEngine::Instance().GetRawSoundOverruns(handle, passed);
+}
+
+int64_t func__sndrawunderruns(int32_t handle, int32_t passed) {
+    return AudioEngine::Instance().GetRawSoundUnderruns(handle, passed);
+}
+
 int32_t func__sndnew(uint32_t frames, int32_t channels, int32_t bits, uint32_t sampleRate, int32_t passed) {
     return AudioEngine::Instance().CreateSound(frames, channels, bits, sampleRate, passed);
 }
@@ -29,6 +29,7 @@
 #include <limits>
 #include <stack>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
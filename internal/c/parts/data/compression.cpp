@@ -4,10 +4,15 @@
 //-----------------------------------------------------------------------------------------------------
 
 #include "compression.h"
+#include "error_handle.h"
 #include "hashing.h"
 #include "libqb-common.h"
 #include "miniz.h"
 #include "qbs.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <memory>
 #include <vector>
 
 /// @brief Computes the Adler-32 checksum of the given text.
@@ -68,16 +73,242 @@ qbs *func__inflate(qbs *text, int64_t originalSize, int32_t passed) {
             return qbs_new(0, 1); // simply return an empty qbs if originalSize is zero or negative
         }
     } else {
-        static const uLongf InflateChunkSize = 10 * 1024 * 1024;
-        std::vector<Byte> dest; // to get rid of malloc() and free()
-        auto compSize = uLongf(text->len);
-        uLongf uncompSize = 0;
-        do {
-            uncompSize += InflateChunkSize; // 10 mb original buffer, resized by 10 mb each pass until it's large enough to hold the uncompressed data.
-            dest.resize(uncompSize);
-        } while (uncompress(&dest[0], &uncompSize, text->chr, compSize) == Z_BUF_ERROR); // and try again with a larger buffer
+        static const size_t InflateMinBufferSize = 64 * 1024;
+        std::vector<Byte> dest(std::max<size_t>(size_t(text->len) * 4, InflateMinBufferSize)); // grown geometrically as required
+        size_t uncompSize = 0;
+
+        z_stream stream = {};
+        if (inflateInit(&stream) != Z_OK) {
+            return qbs_new(0, 1);
+        }
+
+        stream.next_in = text->chr;
+        stream.avail_in = text->len;
+
+        // Decompress in a single pass, doubling the output buffer whenever it runs out of space
+        for (;;) {
+            stream.next_out = &dest[uncompSize];
+            stream.avail_out = unsigned(std::min<size_t>(dest.size() - uncompSize, UINT_MAX));
+            auto status = inflate(&stream, Z_NO_FLUSH);
+            uncompSize = stream.next_out - &dest[0];
+
+            if (status != Z_OK) {
+                break; // end of stream, no more input or corrupt data; we return whatever was decompressed
+            }
+
+            if (!stream.avail_out) {
+                dest.resize(dest.size() * 2);
+            }
+        }
+
+        inflateEnd(&stream);
+
         auto ret = qbs_new(uncompSize, 1);
         memcpy(ret->chr, &dest[0], uncompSize);
         return ret;
     }
 }
+
+/// @brief Decompresses data the first time it is asked for and returns a read-only view of the result.
+/// This is what _EMBEDDED$() uses for $EMBED files that the compiler stored deflated.
+/// @param src Pointer to the compressed data.
+/// @param srcSize The size of the compressed data.
+/// @param originalSize The size of the uncompressed data.
+/// @param cache Holds the uncompressed data between calls (nullptr before the first call).
+/// @return A temporary read-only qbs over the uncompressed data.
+qbs *compression_inflate_view(const uint8_t *src, int32_t srcSize, int32_t originalSize, uint8_t **cache) {
+    if (!*cache) {
+        auto dest = reinterpret_cast<uint8_t *>(malloc(std::max(originalSize, 1)));
+        if (!dest) {
+            error(QB_ERROR_OUT_OF_MEMORY);
+            return qbs_new(0, 1);
+        }
+
+        auto uncompSize = uLongf(originalSize);
+        uncompress(dest, &uncompSize, src, uLong(srcSize)); // the compiler wrote this data, so no error checking
+        *cache = dest;
+    }
+
+    return qbs_new_txt_len(reinterpret_cast<const char *>(*cache), originalSize);
+}
+
+/// @brief A DEFLATE or INFLATE stream created by _DEFLATEOPEN or _INFLATEOPEN.
+struct CompressionStream {
+    z_stream stream;
+    bool isDeflate;
+    bool isFinished;
+};
+
+/// @brief Streams indexed by (handle - 1). Closed slots are nullptr and are reused.
+static std::vector<std::unique_ptr<CompressionStream>> compressionStreams;
+
+/// @brief Adds a stream to compressionStreams.
+/// @param cs The stream to add.
+/// @return The handle of the stream (> 0).
+static int32_t compression_stream_add(std::unique_ptr<CompressionStream> cs) {
+    for (size_t i = 0; i < compressionStreams.size(); i++) {
+        if (!compressionStreams[i]) {
+            compressionStreams[i] = std::move(cs);
+            return int32_t(i + 1);
+        }
+    }
+
+    compressionStreams.push_back(std::move(cs));
+    return int32_t(compressionStreams.size());
+}
+
+/// @brief Looks up a stream and raises an error if the handle is not a valid stream of the requested kind.
+/// @param handle The handle returned by _DEFLATEOPEN or _INFLATEOPEN.
+/// @param isDeflate True for DEFLATE streams, false for INFLATE streams.
+/// @return The stream or nullptr if the handle is invalid.
+static CompressionStream *compression_stream_get(int32_t handle, bool isDeflate) {
+    if (handle < 1 || size_t(handle) > compressionStreams.size() || !compressionStreams[handle - 1] ||
+        compressionStreams[handle - 1]->isDeflate != isDeflate) {
+        error(QB_ERROR_INVALID_HANDLE);
+        return nullptr;
+    }
+
+    return compressionStreams[handle - 1].get();
+}
+
+/// @brief Feeds data to a stream and collects everything it outputs.
+/// @param cs The stream.
+/// @param data The data to compress or decompress.
+/// @param flush Z_NO_FLUSH, or Z_FINISH to end a DEFLATE stream.
+/// @return A new qbs object containing the output.
+static qbs *compression_stream_process(CompressionStream *cs, qbs *data, int flush) {
+    static Byte buffer[64 * 1024];
+    std::vector<Byte> output;
+
+    cs->stream.next_in = data->chr;
+    cs->stream.avail_in = data->len;
+
+    while (!cs->isFinished) {
+        cs->stream.next_out = buffer;
+        cs->stream.avail_out = sizeof(buffer);
+        auto status = cs->isDeflate ? deflate(&cs->stream, flush) : inflate(&cs->stream, Z_SYNC_FLUSH);
+        output.insert(output.end(), buffer, cs->stream.next_out);
+
+        if (status == Z_STREAM_END) {
+            cs->isFinished = true;
+        } else if (status != Z_OK) {
+            if (status != Z_BUF_ERROR) {
+                error(QB_ERROR_ILLEGAL_FUNCTION_CALL); // corrupt input
+            }
+            break; // no progress is possible without more input
+        } else if (cs->stream.avail_out && !cs->stream.avail_in && flush != Z_FINISH) {
+            break; // all input consumed and all pending output collected
+        }
+    }
+
+    auto ret = qbs_new(output.size(), 1);
+    if (!output.empty()) {
+        memcpy(ret->chr, &output[0], output.size());
+    }
+    return ret;
+}
+
+/// @brief Starts a DEFLATE stream that compresses data chunk by chunk.
+/// @param level The compression level (0-10). 10 is the highest level and 0 is no compression.
+/// @param passed Flag indicating if level was passed by the caller.
+/// @return A handle for use with _DEFLATECHUNK$ and _DEFLATECLOSE.
+int32_t func__deflateopen(int32_t level, int32_t passed) {
+    if (!passed) {
+        level = MZ_DEFAULT_COMPRESSION;
+    }
+
+    auto cs = std::make_unique<CompressionStream>();
+    cs->stream = {};
+    cs->isDeflate = true;
+    cs->isFinished = false;
+
+    if (deflateInit(&cs->stream, level) != Z_OK) {
+        error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
+        return 0;
+    }
+
+    return compression_stream_add(std::move(cs));
+}
+
+/// @brief Compresses the next chunk of a DEFLATE stream.
+/// @param handle The handle returned by _DEFLATEOPEN.
+/// @param src The data to compress.
+/// @param finish If non-zero, all remaining compressed data is returned and the stream ends.
+/// @param passed Flag indicating if finish was passed by the caller.
+/// @return The compressed data that is ready. This may be empty until enough input has been collected.
+qbs *func__deflatechunk(int32_t handle, qbs *src, int32_t finish, int32_t passed) {
+    auto cs = compression_stream_get(handle, true);
+    if (!cs) {
+        return qbs_new(0, 1);
+    }
+
+    if (cs->isFinished) {
+        error(QB_ERROR_ILLEGAL_FUNCTION_CALL); // the stream has already been finished
+        return qbs_new(0, 1);
+    }
+
+    return compression_stream_process(cs, src, (passed && finish) ? Z_FINISH : Z_NO_FLUSH);
+}
+
+/// @brief Frees a DEFLATE stream.
+/// @param handle The handle returned by _DEFLATEOPEN.
+void sub__deflateclose(int32_t handle) {
+    if (!compression_stream_get(handle, true)) {
+        return;
+    }
+
+    deflateEnd(&compressionStreams[handle - 1]->stream);
+    compressionStreams[handle - 1].reset();
+}
+
+/// @brief Starts an INFLATE stream that decompresses data chunk by chunk.
+/// @return A handle for use with _INFLATECHUNK$, _INFLATEEOF and _INFLATECLOSE.
+int32_t func__inflateopen() {
+    auto cs = std::make_unique<CompressionStream>();
+    cs->stream = {};
+    cs->isDeflate = false;
+    cs->isFinished = false;
+
+    if (inflateInit(&cs->stream) != Z_OK) {
+        error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
+        return 0;
+    }
+
+    return compression_stream_add(std::move(cs));
+}
+
+/// @brief Decompresses the next chunk of an INFLATE stream.
+/// @param handle The handle returned by _INFLATEOPEN.
+/// @param src The compressed data. Any data past the end of the compressed stream is ignored.
+/// @return The decompressed data that is ready.
+qbs *func__inflatechunk(int32_t handle, qbs *src) {
+    auto cs = compression_stream_get(handle, false);
+    if (!cs) {
+        return qbs_new(0, 1);
+    }
+
+    return compression_stream_process(cs, src, Z_NO_FLUSH);
+}
+
+/// @brief Checks if an INFLATE stream has decompressed the end of the compressed data.
+/// @param handle The handle returned by _INFLATEOPEN.
+/// @return -1 if the end of the stream was reached, 0 otherwise.
+int32_t func__inflateeof(int32_t handle) {
+    auto cs = compression_stream_get(handle, false);
+    if (!cs) {
+        return 0;
+    }
+
+    return cs->isFinished ? -1 : 0;
+}
+
+/// @brief Frees an INFLATE stream.
+/// @param handle The handle returned by _INFLATEOPEN.
+void sub__inflateclose(int32_t handle) {
+    if (!compression_stream_get(handle, false)) {
+        return;
+    }
+
+    inflateEnd(&compressionStreams[handle - 1]->stream);
+    compressionStreams[handle - 1].reset();
+}
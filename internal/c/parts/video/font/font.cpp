@@ -16,6 +16,7 @@
 #include <cstdio>
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include <list>
 #include <locale>
 #include <string>
 #include <unordered_map>
@@ -149,7 +150,7 @@ struct FontManager {
             // Usually the bitmap size & metrics returned by FT for mono and gray can be the same
             // But it's a bad idea to assume that is the case every time
             struct Bitmap {
-                uint8_t *data;       // pointer to the raw pixels
+                uint8_t *data;       // pointer to the raw pixels in the font's glyph atlas (nullptr until this variant is rasterized)
                 FT_Vector size;      // bitmap width & height in pixels
                 FT_Pos advanceWidth; // glyph advance width in pixels
                 FT_Vector bearing;   // glyph left and top side bearing in pixels
@@ -174,14 +175,6 @@ struct FontManager {
                 bitmap = nullptr;
             }
 
-            /// @brief Frees any cached glyph bitmap
-            ~Glyph() {
-                // image_log_trace("Freeing bitmaps %p, %p", bmpMono.data, bmpGray.data);
-
-                free(bmpGray.data);
-                free(bmpMono.data);
-            }
-
             /// @brief Assuming a glyph was previously loaded and rendered by FreeType, this will prepare an internal bitmap struct
             /// @param bmp A pointer to a bitmap struct to prepare
             /// @param parentFont The parent font object
@@ -214,7 +207,7 @@ struct FontManager {
                     // image_log_trace("Creating empty (%i x %i) bitmap for missing glyph", bmp->size.x, bmp->size.y);
 
                     // Allocate zeroed memory for monochrome bitmap
-                    bmp->data = (uint8_t *)calloc(bmp->size.x, bmp->size.y);
+                    bmp->data = parentFont->atlas.Allocate(bmp->size.x * bmp->size.y);
                     if (!bmp->data) {
                         image_log_error("Failed to allocate memory for empty glyph bitmap");
                         *bmp = {};
@@ -226,7 +219,7 @@ struct FontManager {
 
                     // So, we have a valid glyph bitmap. We'll use that
                     // Allocate zeroed memory for the bitmap
-                    bmp->data = (uint8_t *)calloc(bmp->size.x, bmp->size.y);
+                    bmp->data = parentFont->atlas.Allocate(bmp->size.x * bmp->size.y);
                     if (!bmp->data) {
                         image_log_error("Failed to allocate memory for glyph bitmap");
                         *bmp = {};
@@ -249,8 +242,8 @@ struct FontManager {
                         }
                     } else {
                         image_log_error("Unknown bitmap pixel mode %i", (int)parentFont->face->glyph->bitmap.pixel_mode); // this should never happen
-                        free(bmp->data);
-                        *bmp = {};
+                        *bmp = {}; // the atlas space is simply left unused
+
                         return false;
                     }
                 }
@@ -258,19 +251,13 @@ struct FontManager {
                 return true;
             }
 
-            /// @brief Caches a glyph bitmap with a given codepoint and this happens only once
+            /// @brief Caches the mono or gray bitmap of a glyph with a given codepoint. Each variant is only rasterized once, when it is first needed
             /// @param codepoint A valid UTF-32 codepoint
+            /// @param isMono True for mono bitmap and false for gray
             /// @param parentFont The parent font object
             /// @return True if successful or if bitmap is already cached
-            bool CacheBitmap(char32_t codepoint, Font *parentFont) {
-                if (!bitmap) {
-                    // Get the glyph index first and store it
-                    // Note that this can return a valid glyph index but the index need not have any glyph bitmap
-                    index = FT_Get_Char_Index(parentFont->face, codepoint);
-                    if (!index) {
-                        image_log_error("Got glyph index zero for codepoint %lu", codepoint);
-                    }
-
+            bool CacheBitmap(char32_t codepoint, bool isMono, Font *parentFont) {
+                if (isMono && !bmpMono.data) {
                     // Load the mono glyph to query details and render
                     if (FT_Load_Glyph(parentFont->face, index, FT_LOAD_TARGET_MONO)) {
                         image_log_error("Failed to load mono glyph for codepoint %lu (%u)", codepoint, index);
@@ -285,7 +272,7 @@ struct FontManager {
                         image_log_error("Failed to prepare mono glyph for codepoint %lu (%u)", codepoint, index);
                         return false;
                     }
-
+                } else if (!isMono && !bmpGray.data) {
                     // Load the gray glyph to query details and render
                     if (FT_Load_Char(parentFont->face, codepoint, FT_LOAD_RENDER)) {
                         image_log_error("Failed to load gray glyph for codepoint %lu (%u)", codepoint, index);
@@ -298,23 +285,13 @@ struct FontManager {
 
                     if (!PrepareBitmap(&bmpGray, parentFont)) {
                         image_log_error("Failed to prepare gray glyph for codepoint %lu (%u)", codepoint, index);
-                        free(bmpMono.data); // free mono bitmap
-                        bmpMono = {};
                         return false;
                     }
-
-                    /*
-                    image_log_trace("Bitmap cached (%p, %p) for codepoint %u, index %i", bmpMono.data, bmpGray.data, codepoint, index);
-                    image_log_trace("Mono: W = %i, H = %i, AW = %i, BX = %i, BY = %i", bmpMono.size.x, bmpMono.size.y, bmpMono.advanceWidth, bmpMono.bearing.x,
-                                    bmpMono.bearing.y);
-                    image_log_trace("Gray: W = %i, H = %i, AW = %i, BX = %i, BY = %i", bmpGray.size.x, bmpGray.size.y, bmpGray.advanceWidth, bmpGray.bearing.x,
-                                    bmpGray.bearing.y);
-                    */
-
-                    bitmap = &bmpGray; // set bitmap to gray bitmap by default
                 }
 
-                return bitmap != nullptr;
+                bitmap = isMono ? &bmpMono : &bmpGray; // select the correct bitmap
+
+                return true;
             }
 
             /// @brief Renders the glyph bitmap to the target bitmap using "alpha blending"
@@ -343,7 +320,76 @@ struct FontManager {
             }
         };
 
-        std::unordered_map<char32_t, Glyph *> glyphs; // holds pointers to cached glyph data for codepoints
+        /// @brief Packs the glyph bitmaps of a font into large pages, so that glyphs don't need an allocation each and sit close together in memory
+        struct GlyphAtlas {
+            static constexpr size_t PAGE_SIZE = 64 * 1024;
+
+            std::vector<uint8_t *> pages; // all pages (including oversized single glyph ones), for freeing
+            uint8_t *page;                // the page new bitmaps are packed into
+            size_t pageUsed;              // bytes used in 'page'
+
+            GlyphAtlas() {
+                page = nullptr;
+                pageUsed = PAGE_SIZE;
+            }
+
+            ~GlyphAtlas() {
+                Clear();
+            }
+
+            /// @brief Returns zeroed memory for a glyph bitmap, valid until Clear() is called
+            /// @param bytes The bitmap size in bytes
+            /// @return A pointer to the memory or nullptr if allocation failed
+            uint8_t *Allocate(size_t bytes) {
+                if (bytes > PAGE_SIZE / 4) {
+                    // Huge glyphs get a page of their own so that they don't waste the rest of the current page
+                    auto mem = (uint8_t *)calloc(bytes, 1);
+                    if (mem)
+                        pages.push_back(mem);
+                    return mem;
+                }
+
+                if (pageUsed + bytes > PAGE_SIZE) {
+                    auto mem = (uint8_t *)calloc(PAGE_SIZE, 1);
+                    if (!mem)
+                        return nullptr;
+                    pages.push_back(mem);
+                    page = mem;
+                    pageUsed = 0;
+                }
+
+                auto mem = page + pageUsed;
+                pageUsed += bytes;
+                return mem;
+            }
+
+            /// @brief Frees all pages
+            void Clear() {
+                for (auto mem : pages)
+                    free(mem);
+
+                pages.clear();
+                page = nullptr;
+                pageUsed = PAGE_SIZE;
+            }
+        };
+
+        /// @brief A rendered string kept around by FontRenderTextUTF32() for reuse
+        struct RenderedString {
+            std::u32string key; // the render mode followed by the codepoints
+            std::vector<uint8_t> pixels;
+            FT_Vector size;
+        };
+
+        static constexpr size_t RENDER_CACHE_MAX_ENTRIES = 128;
+        static constexpr size_t RENDER_CACHE_MAX_BYTES = 4 * 1024 * 1024;
+
+        GlyphAtlas atlas;                              // the bitmap data of all cached glyphs
+        Glyph *latin1Glyphs[256];                      // cached glyphs for codepoints 0 - 255, these are looked up the most
+        std::unordered_map<char32_t, Glyph *> glyphs;  // holds pointers to cached glyph data for all other codepoints
+        std::list<RenderedString> renderCache;         // recently rendered strings, most recently used first
+        std::unordered_map<std::u32string, std::list<RenderedString>::iterator> renderCacheIndex;
+        size_t renderCacheBytes;                       // total size of the pixel data in renderCache
 
         // Delete copy and move constructors and assignments
         Font(const Font &) = delete;
@@ -357,6 +403,8 @@ struct FontManager {
             fontData = nullptr;
             face = nullptr;
             monospaceWidth = defaultHeight = baseline = options = 0;
+            std::fill(std::begin(latin1Glyphs), std::end(latin1Glyphs), nullptr);
+            renderCacheBytes = 0;
         }
 
         /// @brief Frees any cached glyph
@@ -372,46 +420,89 @@ struct FontManager {
             free(fontData);
             image_log_trace("Raw font data buffer freed");
 
+            ClearCache();
+        }
+
+        /// @brief Frees all cached glyphs, their bitmaps and the rendered strings
+        void ClearCache() {
             image_log_trace("Freeing cached glyphs");
-            // Free any allocated glyph manager
-            // This should also call the glyphs destructor freeing the bitmap data
+
+            for (auto &glyph : latin1Glyphs) {
+                delete glyph;
+                glyph = nullptr;
+            }
+
             for (auto &it : glyphs)
                 delete it.second;
+
+            glyphs.clear();
+            atlas.Clear();
+
+            renderCache.clear();
+            renderCacheIndex.clear();
+            renderCacheBytes = 0;
         }
 
-        /// @brief Creates a glyph belonging to a codepoint, caches its bitmap + info and adds it to the hash map
+        /// @brief Creates a glyph belonging to a codepoint, caches its bitmap + info and adds it to the glyph table
         /// @param codepoint A valid UTF-32 codepoint
         /// @param isMono True for mono bitmap and false for gray
-        /// @return The glyph pointer if successful or if the glyph is already in the map, nullptr otherwise
+        /// @return The glyph pointer if successful or if the glyph is already in the table, nullptr otherwise
         Glyph *GetGlyph(char32_t codepoint, bool isMono) {
-            if (glyphs.count(codepoint) == 0) {
+            auto &glyph = codepoint < 256 ? latin1Glyphs[codepoint] : glyphs[codepoint];
+
+            if (!glyph) {
                 // The glyph is not cached yet
-                auto newGlyph = new Glyph;
+                glyph = new Glyph;
 
-                if (!newGlyph) {
-                    image_log_error("Failed to allocate memory");
-                    return nullptr; // failed to allocate memory
+                // Get the glyph index first and store it
+                // Note that this can return a valid glyph index but the index need not have any glyph bitmap
+                glyph->index = FT_Get_Char_Index(face, codepoint);
+                if (!glyph->index) {
+                    image_log_error("Got glyph index zero for codepoint %lu", codepoint);
                 }
 
-                // Cache the glyph info and bitmap
-                if (!newGlyph->CacheBitmap(codepoint, this)) {
-                    delete newGlyph;
-                    image_log_error("Failed to cache glyph data");
-                    return nullptr; // failed to cache bitmap
-                }
+                image_log_trace("Glyph for codepoint %u created", codepoint);
+            }
 
-                glyphs[codepoint] = newGlyph;                                        // save the Glyph pointer to the map using the codepoint as key
-                newGlyph->bitmap = isMono ? &newGlyph->bmpMono : &newGlyph->bmpGray; // select the correct bitmap
+            // Cache the glyph bitmap for this mode if this is the first time it is needed
+            if (!glyph->CacheBitmap(codepoint, isMono, this)) {
+                image_log_error("Failed to cache glyph data");
+                return nullptr; // failed to cache bitmap
+            }
 
-                image_log_trace("Glyph data for codepoint %u successfully cached", codepoint);
+            return glyph;
+        }
 
-                return newGlyph; // return the glyph pointer
-            }
+        /// @brief Looks up a string rendered earlier with the same mode
+        /// @param key The render mode followed by the codepoints
+        /// @return The cached string or nullptr if it is not in the cache
+        RenderedString *FindRenderedString(const std::u32string &key) {
+            auto it = renderCacheIndex.find(key);
+            if (it == renderCacheIndex.end())
+                return nullptr;
+
+            renderCache.splice(renderCache.begin(), renderCache, it->second); // mark as most recently used
+            return &*it->second;
+        }
 
-            auto glyph = glyphs[codepoint];                             // we already have the glyph cached, so simply return the pointer
-            glyph->bitmap = isMono ? &glyph->bmpMono : &glyph->bmpGray; // select the correct bitmap
+        /// @brief Adds a rendered string to the cache, dropping the least recently used strings if the cache is full
+        /// @param key The render mode followed by the codepoints
+        /// @param pixels The rendered alpha values
+        /// @param size The size of the rendered string in pixels
+        void AddRenderedString(const std::u32string &key, const uint8_t *pixels, const FT_Vector &size) {
+            size_t bytes = size_t(size.x) * size.y;
+            if (bytes > RENDER_CACHE_MAX_BYTES / 8)
+                return; // not worth evicting everything else for
+
+            while (!renderCache.empty() && (renderCache.size() >= RENDER_CACHE_MAX_ENTRIES || renderCacheBytes + bytes > RENDER_CACHE_MAX_BYTES)) {
+                renderCacheBytes -= renderCache.back().pixels.size();
+                renderCacheIndex.erase(renderCache.back().key);
+                renderCache.pop_back();
+            }
 
-            return glyph;
+            renderCache.push_front({key, std::vector<uint8_t>(pixels, pixels + bytes), size});
+            renderCacheIndex[key] = renderCache.begin();
+            renderCacheBytes += bytes;
         }
 
         /// @brief This returns the length of a UTF32 codepoint array in pixels
@@ -592,15 +683,9 @@ struct FontManager {
             fonts[handle]->fontData = nullptr;
             image_log_trace("Raw font data buffer freed");
 
-            image_log_trace("Freeing cached glyphs");
-            // Free cached glyph data
-            // This should also call the glyphs destructor freeing the bitmap data
-            for (auto &it : fonts[handle]->glyphs)
-                delete it.second;
-
-            // Reset the hash map
-            fonts[handle]->glyphs.clear();
-            image_log_trace("Hash map cleared");
+            // Free cached glyph data and rendered strings
+            fonts[handle]->ClearCache();
+            image_log_trace("Glyph cache cleared");
 
             // Now simply set the 'isUsed' member to false so that the handle can be recycled
             fonts[handle]->isUsed = false;
@@ -900,6 +985,31 @@ bool FontRenderTextUTF32(int32_t fh, const char32_t *codepoint, int32_t codepoin
         return codepoints == 0; // true if zero, false if -ve
 
     auto isMonochrome = bool(options & FONT_RENDER_MONOCHROME); // do we need to do monochrome rendering?
+
+    // The string width is measured using the glyphs for the write page's mode, so that is part of the cache key as well
+    auto isWidthMonochrome = (write_page->bytes_per_pixel == 1) || ((write_page->bytes_per_pixel == 4) && (write_page->alpha_disabled)) ||
+                             (fnt->options & FONT_LOAD_DONTBLEND);
+
+    static std::u32string key;
+    key.assign(1, char32_t(isMonochrome | (isWidthMonochrome << 1)));
+    key.append(codepoint, codepoints);
+
+    // Text that is drawn over and over (like a HUD) is usually the same from one frame to the next
+    auto cached = fnt->FindRenderedString(key);
+    if (cached) {
+        auto outBuf = (uint8_t *)malloc(cached->pixels.size());
+        if (!outBuf)
+            return false;
+
+        memcpy(outBuf, cached->pixels.data(), cached->pixels.size());
+
+        *out_data = outBuf;
+        *out_x = cached->size.x;
+        *out_y = cached->size.y;
+
+        return true;
+    }
+
     FT_Vector strPixSize = {
         fnt->GetStringPixelWidth(codepoint, codepoints), // get the total buffer width
         fnt->defaultHeight                               // height is always set by the QB64
@@ -950,6 +1060,8 @@ bool FontRenderTextUTF32(int32_t fh, const char32_t *codepoint, int32_t codepoin
 
     // image_log_trace("Buffer width = %li, render width = %li", strPixSize.x, penX);
 
+    fnt->AddRenderedString(key, outBuf, strPixSize);
+
     *out_data = outBuf;
     *out_x = strPixSize.x;
     *out_y = strPixSize.y;
@@ -6,6 +6,7 @@ IMAGE_SRCS := \
 	pixelscalers/hqx.cpp \
 	pixelscalers/mmpx.cpp \
 	pixelscalers/sxbr.cpp \
+	png_write/png_write.cpp \
 	qoi/qoi.cpp \
 	sg_curico/sg_curico.cpp \
 	sg_pcx/sg_pcx.cpp \
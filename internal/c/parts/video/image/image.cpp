@@ -14,29 +14,36 @@
 //      jo_gif (https://www.jonolick.com/code)
 //      pixelscalers (https://github.com/janert/pixelscalers)
 //      mmpx (https://github.com/ITotalJustice/mmpx)
+//      miniz (https://github.com/richgel999/miniz)
 //
 //-----------------------------------------------------------------------------------------------------
 
 #include "image.h"
 #include "../../../libqb.h"
+#include "condvar.h"
 #include "error_handle.h"
 #include "filepath.h"
 #include "graphics.h"
 #include "jo_gif/jo_gif.h"
 #include "libqb-common.h"
+#include "mutex.h"
 #include "nanosvg/nanosvg.h"
 #include "nanosvg/nanosvgrast.h"
 #include "pixelscalers/pixelscalers.h"
+#include "png_write/png_write.h"
 #include "qbs.h"
 #include "qoi/qoi.h"
 #include "sg_curico/sg_curico.h"
 #include "sg_pcx/sg_pcx.h"
 #include "stb/stb_image.h"
 #include "stb/stb_image_write.h"
+#include "thread.h"
 #include "tiny_webp/tiny_webp.h"
 #include <algorithm>
 #include <cctype>
+#include <deque>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -155,68 +162,6 @@ static uint32_t *image_svg_load(NSVGimage *image, int32_t *xOut, int32_t *yOut,
     return pixels;
 }
 
-/// @brief Loads an SVG image file from disk
-/// @param fileName The file path name to load
-/// @param xOut Out: width in pixels. This cannot be NULL
-/// @param yOut Out: height in pixels. This cannot be NULL
-/// @param scaler An optional pixel scaler to use (it just used this to scale internally)
-/// @param components Out: color channels. This cannot be NULL
-/// @param isVG Out: vector graphics? Always set to true
-/// @return A pointer to the raw pixel data in RGBA format or NULL on failure
-static uint32_t *image_svg_load_from_file(const char *fileName, int32_t *xOut, int32_t *yOut, ImageScaler scaler, int *components, bool *isVG) {
-    if (!filepath_has_extension(fileName, "svg"))
-        return nullptr;
-
-    auto fp = fopen(fileName, "rb");
-    if (!fp)
-        return nullptr;
-
-    if (fseek(fp, 0, SEEK_END)) {
-        fclose(fp);
-        return nullptr;
-    }
-
-    auto size = ftell(fp);
-    if (size < 0) {
-        fclose(fp);
-        return nullptr;
-    }
-
-    rewind(fp);
-
-    auto svgString = (char *)malloc(size + 1);
-    if (!svgString) {
-        fclose(fp);
-        return nullptr;
-    }
-
-    if (long(fread(svgString, sizeof(uint8_t), size, fp)) != size) {
-        free(svgString);
-        fclose(fp);
-        return nullptr;
-    }
-    svgString[size] = '\0'; // must be null terminated
-
-    fclose(fp);
-
-    // Check if it has a valid SVG start tag
-    if (!strstr(svgString, "<svg")) {
-        free(svgString);
-        return nullptr;
-    }
-
-    auto image = nsvgParse(svgString, "px", 96.0f); // important note: changes the string
-    if (!image) {
-        free(svgString);
-        return nullptr;
-    }
-
-    auto pixels = image_svg_load(image, xOut, yOut, scaler, components, isVG); // this is where everything else is freed
-    free(svgString);
-
-    return pixels;
-}
-
 /// @brief Loads an SVG image file from memory
 /// @param buffer The raw pointer to the file in memory
 /// @param size The size of the file in memory
@@ -252,23 +197,6 @@ static uint32_t *image_svg_load_from_memory(const uint8_t *buffer, size_t size,
     return pixels;
 }
 
-/// @brief Loads a QOI image file from disk
-/// @param fileName The file path name to load
-/// @param xOut Out: width in pixels. This cannot be NULL
-/// @param yOut Out: height in pixels. This cannot be NULL
-/// @param components Out: color channels. This cannot be NULL
-/// @return A pointer to the raw pixel data in RGBA format or NULL on failure
-static uint32_t *image_qoi_load_from_file(const char *fileName, int32_t *xOut, int32_t *yOut, int *components) {
-    qoi_desc desc;
-    auto pixels = reinterpret_cast<uint32_t *>(qoi_read(fileName, &desc, sizeof(uint32_t)));
-    if (pixels) {
-        *xOut = desc.width;
-        *yOut = desc.height;
-        *components = desc.channels;
-    }
-    return pixels;
-}
-
 /// @brief Loads a QOI image file from memory
 /// @param buffer The raw pointer to the file in memory
 /// @param size The size of the file in memory
@@ -287,20 +215,6 @@ static uint32_t *image_qoi_load_from_memory(const uint8_t *buffer, size_t size,
     return pixels;
 }
 
-/// @brief Loads a tiny_webp image file from disk.
-/// @param fileName The file path name to load.
-/// @param xOut Out: width in pixels. This cannot be NULL.
-/// @param yOut Out: height in pixels. This cannot be NULL.
-/// @param components Out: color channels. This cannot be NULL.
-/// @return A pointer to the raw pixel data in RGBA format or NULL on failure.
-static uint32_t *image_tiny_webp_load_from_file(const char *fileName, int32_t *xOut, int32_t *yOut, int *components) {
-    auto pixels = reinterpret_cast<uint32_t *>(twp_read(fileName, xOut, yOut, twp_FORMAT_RGBA, 0));
-    if (pixels) {
-        *components = sizeof(uint32_t);
-    }
-    return pixels;
-}
-
 /// @brief Loads a tiny_webp image file from memory.
 /// @param buffer The raw pointer to the file in memory.
 /// @param size The size of the file in memory.
@@ -316,58 +230,106 @@ static uint32_t *image_tiny_webp_load_from_memory(const uint8_t *buffer, size_t
     return pixels;
 }
 
-/// @brief Decodes an image file from a file using the sg_pcx & stb_image libraries.
-/// @param fileName A valid filename
+/// @brief Image file formats that have their own decoder
+enum class ImageFormat { UNKNOWN = 0, STB, WEBP, PCX, QOI, CURICO, SVG };
+
+/// @brief Decoders in the order they are tried when the format could not be detected or the detected decoder failed
+static const ImageFormat g_ImageFormatFallback[] = {ImageFormat::STB, ImageFormat::WEBP, ImageFormat::PCX, ImageFormat::QOI, ImageFormat::CURICO, ImageFormat::SVG};
+
+/// @brief Identifies an image file from its first few bytes so that it can be passed straight to the right decoder
+/// @param data The raw pointer to the file in memory
+/// @param size The size of the file in memory
+/// @return The detected format or ImageFormat::UNKNOWN (e.g. TGA, which has no signature)
+static ImageFormat image_detect_format(const uint8_t *data, size_t size) {
+    auto matches = [data, size](size_t offset, const char *magic) {
+        auto len = strlen(magic);
+        return size >= offset + len && !memcmp(data + offset, magic, len);
+    };
+
+    if (matches(0, "\x89PNG") || matches(0, "\xFF\xD8\xFF") || matches(0, "GIF8") || matches(0, "BM") || matches(0, "8BPS") || matches(0, "#?RADIANCE") ||
+        matches(0, "#?RGBE") || matches(0, "\x53\x80\xF6\x34") || (size > 2 && data[0] == 'P' && (data[1] == '5' || data[1] == '6') && isspace(data[2])))
+        return ImageFormat::STB;
+
+    if (matches(0, "RIFF") && matches(8, "WEBP"))
+        return ImageFormat::WEBP;
+
+    if (matches(0, "qoif"))
+        return ImageFormat::QOI;
+
+    if (size >= 128 && data[0] == 0x0A && data[1] <= 5 && data[2] <= 1)
+        return ImageFormat::PCX;
+
+    // ICONDIR (reserved = 0, type = 1 or 2, count > 0) followed by a sane first ICONDIRENTRY
+    if (size >= 22 && !data[0] && !data[1] && (data[2] == 1 || data[2] == 2) && !data[3] && (data[4] || data[5]) && !data[9]) {
+        size_t count = data[4] | (data[5] << 8);
+        size_t imageOffset = data[18] | (data[19] << 8) | (data[20] << 16) | (size_t(data[21]) << 24);
+        if (imageOffset >= 6 + count * 16 && imageOffset < size)
+            return ImageFormat::CURICO;
+    }
+
+    // SVG is text, so skip a UTF-8 BOM and leading whitespace and look for markup
+    size_t i = matches(0, "\xEF\xBB\xBF") ? 3 : 0;
+    while (i < size && isspace(data[i]))
+        i++;
+    if (i < size && data[i] == '<')
+        return ImageFormat::SVG;
+
+    return ImageFormat::UNKNOWN;
+}
+
+/// @brief Decodes an image file from memory using a specific decoder
+/// @param format The decoder to use
+/// @param data The raw pointer to the file in memory
+/// @param size The size of the file in memory
 /// @param xOut Out: width in pixels. This cannot be NULL
 /// @param yOut Out: height in pixels. This cannot be NULL
-/// @param scaler An optional pixel scaler to use
+/// @param scaler An optional pixel scaler to use (only used by vector formats)
+/// @param components Out: color channels. This cannot be NULL
+/// @param isVG Out: set to true for vector graphics
 /// @return A pointer to the raw pixel data in RGBA format or NULL on failure
-static uint32_t *image_decode_from_file(const char *fileName, int32_t *xOut, int32_t *yOut, ImageScaler scaler) {
-    auto compOut = 0;
-    auto isVG = false; // we will not use scalers for vector graphics
-
-    image_log_info("Loading image from file %s", fileName);
+static uint32_t *image_decode_format(ImageFormat format, const uint8_t *data, size_t size, int32_t *xOut, int32_t *yOut, ImageScaler scaler, int *components,
+                                     bool *isVG) {
+    uint32_t *pixels = nullptr;
 
-    auto pixels = reinterpret_cast<uint32_t *>(stbi_load(fileName, xOut, yOut, &compOut, 4));
-    image_log_trace("Image dimensions (stb_image) = (%i, %i)", *xOut, *yOut);
+    switch (format) {
+    case ImageFormat::STB:
+        pixels = reinterpret_cast<uint32_t *>(stbi_load_from_memory(reinterpret_cast<const stbi_uc *>(data), size, xOut, yOut, components, 4));
+        image_log_trace("Image dimensions (stb_image) = (%i, %i)", *xOut, *yOut);
+        break;
 
-    if (!pixels) {
-        pixels = image_tiny_webp_load_from_file(fileName, xOut, yOut, &compOut);
+    case ImageFormat::WEBP:
+        pixels = image_tiny_webp_load_from_memory(data, size, xOut, yOut, components);
         image_log_trace("Image dimensions (tiny_webp) = (%i, %i)", *xOut, *yOut);
+        break;
 
-        if (!pixels) {
-            pixels = pcx_load_file(fileName, xOut, yOut, &compOut);
-            image_log_trace("Image dimensions (sg_pcx) = (%i, %i)", *xOut, *yOut);
+    case ImageFormat::PCX:
+        pixels = pcx_load_memory(data, size, xOut, yOut, components);
+        image_log_trace("Image dimensions (sg_pcx) = (%i, %i)", *xOut, *yOut);
+        break;
 
-            if (!pixels) {
-                pixels = image_qoi_load_from_file(fileName, xOut, yOut, &compOut);
-                image_log_trace("Image dimensions (qoi) = (%i, %i)", *xOut, *yOut);
+    case ImageFormat::QOI:
+        pixels = image_qoi_load_from_memory(data, size, xOut, yOut, components);
+        image_log_trace("Image dimensions (qoi) = (%i, %i)", *xOut, *yOut);
+        break;
 
-                if (!pixels) {
-                    pixels = curico_load_file(fileName, xOut, yOut, &compOut);
-                    image_log_trace("Image dimensions (sg_curico) = (%i, %i)", *xOut, *yOut);
+    case ImageFormat::CURICO:
+        pixels = curico_load_memory(data, size, xOut, yOut, components);
+        image_log_trace("Image dimensions (sg_curico) = (%i, %i)", *xOut, *yOut);
+        break;
 
-                    if (!pixels) {
-                        pixels = image_svg_load_from_file(fileName, xOut, yOut, scaler, &compOut, &isVG);
-                        image_log_trace("Image dimensions (nanosvg) = (%i, %i)", *xOut, *yOut);
+    case ImageFormat::SVG:
+        pixels = image_svg_load_from_memory(data, size, xOut, yOut, scaler, components, isVG);
+        image_log_trace("Image dimensions (nanosvg) = (%i, %i)", *xOut, *yOut);
+        break;
 
-                        if (!pixels)
-                            return nullptr; // Return NULL if all attempts failed
-                    }
-                }
-            }
-        }
+    default:
+        break;
     }
 
-    IMAGE_DEBUG_CHECK(compOut > 2);
-
-    if (!isVG)
-        pixels = image_scale(pixels, xOut, yOut, scaler);
-
     return pixels;
 }
 
-/// @brief Decodes an image file from memory using the sg_pcx & stb_image libraries
+/// @brief Decodes an image file from memory. The format is detected from the data and only that decoder is used, unless it fails
 /// @param data The raw pointer to the file in memory
 /// @param size The size of the file in memory
 /// @param xOut Out: width in pixels. This cannot be NULL
@@ -380,43 +342,59 @@ static uint32_t *image_decode_from_memory(const uint8_t *data, size_t size, int3
 
     image_log_info("Loading image from memory");
 
-    auto pixels = reinterpret_cast<uint32_t *>(stbi_load_from_memory(reinterpret_cast<const stbi_uc *>(data), size, xOut, yOut, &compOut, 4));
-    image_log_trace("Image dimensions (stb_image) = (%i, %i)", *xOut, *yOut);
+    auto format = image_detect_format(data, size);
+    image_log_trace("Detected image format = %i", int(format));
 
-    if (!pixels) {
-        pixels = image_tiny_webp_load_from_memory(data, size, xOut, yOut, &compOut);
-        image_log_trace("Image dimensions (tiny_webp) = (%i, %i)", *xOut, *yOut);
+    uint32_t *pixels = nullptr;
+    if (format != ImageFormat::UNKNOWN)
+        pixels = image_decode_format(format, data, size, xOut, yOut, scaler, &compOut, &isVG);
 
-        if (!pixels) {
-            pixels = pcx_load_memory(data, size, xOut, yOut, &compOut);
-            image_log_trace("Image dimensions (sg_pcx) = (%i, %i)", *xOut, *yOut);
+    // Formats without a signature (or files with a misleading one) go through every other decoder
+    for (size_t i = 0; !pixels && i < _countof(g_ImageFormatFallback); i++) {
+        if (g_ImageFormatFallback[i] != format)
+            pixels = image_decode_format(g_ImageFormatFallback[i], data, size, xOut, yOut, scaler, &compOut, &isVG);
+    }
 
-            if (!pixels) {
-                pixels = image_qoi_load_from_memory(data, size, xOut, yOut, &compOut);
-                image_log_trace("Image dimensions (qoi) = (%i, %i)", *xOut, *yOut);
+    if (!pixels)
+        return nullptr; // Return NULL if all attempts failed
 
-                if (!pixels) {
-                    pixels = curico_load_memory(data, size, xOut, yOut, &compOut);
-                    image_log_trace("Image dimensions (sg_curico) = (%i, %i)", *xOut, *yOut);
+    IMAGE_DEBUG_CHECK(compOut > 2);
 
-                    if (!pixels) {
-                        pixels = image_svg_load_from_memory(data, size, xOut, yOut, scaler, &compOut, &isVG);
-                        image_log_trace("Image dimensions (nanosvg) = (%i, %i)", *xOut, *yOut);
+    if (!isVG)
+        pixels = image_scale(pixels, xOut, yOut, scaler);
 
-                        if (!pixels)
-                            return nullptr; // Return NULL if all attempts failed
-                    }
-                }
-            }
+    return pixels;
+}
+
+/// @brief Decodes an image file from disk. The file is read into memory once and then handed to image_decode_from_memory()
+/// @param fileName A valid filename
+/// @param xOut Out: width in pixels. This cannot be NULL
+/// @param yOut Out: height in pixels. This cannot be NULL
+/// @param scaler An optional pixel scaler to use
+/// @return A pointer to the raw pixel data in RGBA format or NULL on failure
+static uint32_t *image_decode_from_file(const char *fileName, int32_t *xOut, int32_t *yOut, ImageScaler scaler) {
+    image_log_info("Loading image from file %s", fileName);
+
+    auto fp = fopen(fileName, "rb");
+    if (!fp)
+        return nullptr;
+
+    std::vector<uint8_t> data;
+    if (!fseek(fp, 0, SEEK_END)) {
+        auto size = ftell(fp);
+        if (size > 0) {
+            rewind(fp);
+            data.resize(size);
+            data.resize(fread(data.data(), sizeof(uint8_t), data.size(), fp));
         }
     }
 
-    IMAGE_DEBUG_CHECK(compOut > 2);
+    fclose(fp);
 
-    if (!isVG)
-        pixels = image_scale(pixels, xOut, yOut, scaler);
+    if (data.empty())
+        return nullptr;
 
-    return pixels;
+    return image_decode_from_memory(data.data(), data.size(), xOut, yOut, scaler);
 }
 
 /// @brief This takes in a 32bpp (BGRA) image raw data and spits out an 8bpp raw image along with it's 256 color (BGRA) palette.
@@ -672,30 +650,36 @@ static bool image_extract_8bpp(const uint32_t *src32, const uint32_t *srcPalette
     return true;
 }
 
-/// @brief This function loads an image into memory and returns valid LONG image handle values that are less than -1
-/// @param qbsFileName The filename or memory buffer (see requirements below) of the image
+/// @brief How an image should be loaded. This is everything _LOADIMAGE gets from its mode& and requirements$ arguments
+struct ImageLoadSettings {
+    int32_t bpp;                 // 32 or 256
+    bool isLoadFromMemory;       // should the image be loaded from memory?
+    bool isHardwareImage;        // should the image be converted to a hardware image?
+    const uint32_t *srcPalette;  // palette used for 8bpp images or NULL for an adaptive palette
+    ImageScaler scaler;          // pixel scaler to use
+};
+
+/// @brief Parses the mode& and requirements$ arguments of _LOADIMAGE
 /// @param bpp 32 = 32bpp, 33 = 32bpp (hardware accelerated), 256=8bpp or 257=8bpp (without palette remap)
 /// @param qbsRequirements A qbs that can contain one or more of: hardware, memory, adaptive
 /// @param passed How many parameters were passed?
-/// @return Valid LONG image handle values that are less than -1 or -1 on failure
-int32_t func__loadimage(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int32_t passed) {
-    if (new_error || !qbsFileName->len) // leave if we do not have a file name, data or there was an error
-        return INVALID_IMAGE_HANDLE;
-
-    auto isLoadFromMemory = false;   // should the image be loaded from memory?
-    auto isHardwareImage = false;    // should the image be converted to a hardware image?
-    auto srcPalette = palette_256;   // use the QB64 256 color palette by default for 8bpp images
-    auto scaler = ImageScaler::NONE; // default to no scaling
+/// @param settings Out: the parsed settings
+/// @return True if successful. False if the arguments are invalid (an error is raised)
+static bool image_parse_load_settings(int32_t bpp, qbs *qbsRequirements, int32_t passed, ImageLoadSettings *settings) {
+    settings->isLoadFromMemory = false;
+    settings->isHardwareImage = false;
+    settings->srcPalette = palette_256;   // use the QB64 256 color palette by default for 8bpp images
+    settings->scaler = ImageScaler::NONE; // default to no scaling
 
     // Handle special cases and set the above flags if required
     image_log_trace("bpp = %i, passed = 0x%X", bpp, passed);
     if (passed & 1) {
         if (bpp == 33) { // hardware image?
-            isHardwareImage = true;
+            settings->isHardwareImage = true;
             bpp = 32;
             image_log_trace("bpp = %i", bpp);
         } else if (bpp == 257) { // adaptive palette?
-            srcPalette = nullptr;
+            settings->srcPalette = nullptr;
             bpp = 256;
             image_log_trace("bpp = %i", bpp);
         }
@@ -703,7 +687,7 @@ int32_t func__loadimage(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int
         if ((bpp != 32) && (bpp != 256)) { // invalid BPP?
             image_log_error("Invalid bpp (%i)", bpp);
             error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
-            return INVALID_IMAGE_HANDLE;
+            return false;
         }
     } else {
         if (write_page->bits_per_pixel < 32) { // default to 8bpp for all legacy screen modes
@@ -715,6 +699,8 @@ int32_t func__loadimage(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int
         }
     }
 
+    settings->bpp = bpp;
+
     // Check requirements string and set appropriate flags
     if ((passed & 2) && qbsRequirements->len) {
         // Parse the requirements string and setup save settings
@@ -724,15 +710,15 @@ int32_t func__loadimage(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int
         image_log_trace("Parsing requirements string: %s", requirements.c_str());
 
         if (requirements.find("HARDWARE") != std::string::npos && bpp == 32) {
-            isHardwareImage = true;
+            settings->isHardwareImage = true;
             image_log_trace("Hardware image selected");
         } else if (requirements.find("ADAPTIVE") != std::string::npos && bpp == 256) {
-            srcPalette = nullptr;
+            settings->srcPalette = nullptr;
             image_log_trace("Adaptive palette selected");
         }
 
         if (requirements.find("MEMORY") != std::string::npos) {
-            isLoadFromMemory = true;
+            settings->isLoadFromMemory = true;
             image_log_trace("Loading image from memory");
         }
 
@@ -740,41 +726,61 @@ int32_t func__loadimage(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int
         for (size_t i = 0; i < _countof(g_ImageScalerName); i++) {
             image_log_trace("Checking for: %s", g_ImageScalerName[i]);
             if (requirements.find(g_ImageScalerName[i]) != std::string::npos) {
-                scaler = (ImageScaler)i;
-                image_log_trace("%s scaler selected", g_ImageScalerName[size_t(scaler)]);
+                settings->scaler = (ImageScaler)i;
+                image_log_trace("%s scaler selected", g_ImageScalerName[size_t(settings->scaler)]);
                 break;
             }
         }
     }
 
-    auto x = 0, y = 0;
+    return true;
+}
+
+/// @brief Decodes an image to BGRA pixels. This does not touch any QB64-PE image state and is safe to call from any thread
+/// @param settings The settings returned by image_parse_load_settings()
+/// @param fileNameOrData The file name or the image file in memory if settings.isLoadFromMemory is set
+/// @param size The length of fileNameOrData
+/// @param xOut Out: width in pixels. This cannot be NULL
+/// @param yOut Out: height in pixels. This cannot be NULL
+/// @return A pointer to the raw pixel data in BGRA format or NULL on failure
+static uint32_t *image_decode(const ImageLoadSettings &settings, const uint8_t *fileNameOrData, size_t size, int32_t *xOut, int32_t *yOut) {
     uint32_t *pixels;
 
-    if (isLoadFromMemory) {
-        pixels = image_decode_from_memory(qbsFileName->chr, qbsFileName->len, &x, &y, scaler);
+    if (settings.isLoadFromMemory) {
+        pixels = image_decode_from_memory(fileNameOrData, size, xOut, yOut, settings.scaler);
     } else {
-        std::string fileName(reinterpret_cast<char *>(qbsFileName->chr), qbsFileName->len);
-        pixels = image_decode_from_file(filepath_fix_directory(fileName), &x, &y, scaler);
+        std::string fileName(reinterpret_cast<const char *>(fileNameOrData), size);
+        pixels = image_decode_from_file(filepath_fix_directory(fileName), xOut, yOut, settings.scaler);
     }
 
-    if (!pixels)
-        return INVALID_IMAGE_HANDLE; // Return invalid handle if loading the image failed
+    if (pixels) {
+        // Convert RGBA to BGRA
+        image_swap_red_blue_buffer(pixels, size_t(*xOut) * *yOut);
+    }
 
-    // Convert RGBA to BGRA
-    size_t size = x * y;
-    image_swap_red_blue_buffer(pixels, size);
+    return pixels;
+}
 
-    auto i = func__newimage(x, y, bpp, 1);
+/// @brief Creates a QB64-PE image from decoded pixels. This must be called from the BASIC thread
+/// @param settings The settings returned by image_parse_load_settings()
+/// @param pixels BGRA pixels returned by image_decode(). These are always freed
+/// @param x Width in pixels
+/// @param y Height in pixels
+/// @return Valid LONG image handle values that are less than -1 or -1 on failure
+static int32_t image_create_from_pixels(const ImageLoadSettings &settings, uint32_t *pixels, int32_t x, int32_t y) {
+    size_t size = size_t(x) * y;
+
+    auto i = func__newimage(x, y, settings.bpp, 1);
     if (i == INVALID_IMAGE_HANDLE) {
         free(pixels);
         return INVALID_IMAGE_HANDLE;
     }
 
     // Convert image to 8bpp if requested by the user
-    if (bpp == 256) {
+    if (settings.bpp == 256) {
         // Try to simply 'extract' the 8bpp image first. If that fails, then 'convert' it to 8bpp
-        if (!image_extract_8bpp(pixels, srcPalette, x, y, img[-i].offset, img[-i].pal)) {
-            image_convert_8bpp(pixels, srcPalette, x, y, img[-i].offset, img[-i].pal);
+        if (!image_extract_8bpp(pixels, settings.srcPalette, x, y, img[-i].offset, img[-i].pal)) {
+            image_convert_8bpp(pixels, settings.srcPalette, x, y, img[-i].offset, img[-i].pal);
         }
     } else {
         memcpy(img[-i].offset32, pixels, size * sizeof(uint32_t));
@@ -784,7 +790,7 @@ int32_t func__loadimage(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int
     free(pixels);
 
     // This only executes if bpp is 32
-    if (isHardwareImage) {
+    if (settings.isHardwareImage) {
         image_log_trace("Making hardware image");
 
         auto iHardware = func__copyimage(i, 33, 1);
@@ -797,6 +803,472 @@ int32_t func__loadimage(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int
     return i;
 }
 
+/// @brief This function loads an image into memory and returns valid LONG image handle values that are less than -1
+/// @param qbsFileName The filename or memory buffer (see requirements below) of the image
+/// @param bpp 32 = 32bpp, 33 = 32bpp (hardware accelerated), 256=8bpp or 257=8bpp (without palette remap)
+/// @param qbsRequirements A qbs that can contain one or more of: hardware, memory, adaptive
+/// @param passed How many parameters were passed?
+/// @return Valid LONG image handle values that are less than -1 or -1 on failure
+int32_t func__loadimage(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int32_t passed) {
+    if (new_error || !qbsFileName->len) // leave if we do not have a file name, data or there was an error
+        return INVALID_IMAGE_HANDLE;
+
+    ImageLoadSettings settings;
+    if (!image_parse_load_settings(bpp, qbsRequirements, passed, &settings))
+        return INVALID_IMAGE_HANDLE;
+
+    auto x = 0, y = 0;
+    auto pixels = image_decode(settings, qbsFileName->chr, qbsFileName->len, &x, &y);
+    if (!pixels)
+        return INVALID_IMAGE_HANDLE; // Return invalid handle if loading the image failed
+
+    return image_create_from_pixels(settings, pixels, x, y);
+}
+
+/// @brief An image queued by _LOADIMAGEASYNC
+struct ImageLoadJob {
+    ImageLoadSettings settings;
+    std::vector<uint8_t> fileNameOrData; // a copy because the BASIC string can change while the job is queued
+    uint32_t *pixels;
+    int32_t x, y;
+    bool isDone;
+};
+
+/// @brief The worker pool that decodes images queued by _LOADIMAGEASYNC
+static struct {
+    libqb_mutex *lock;
+    libqb_condvar *jobQueued;
+    libqb_condvar *jobDone;
+    std::deque<ImageLoadJob *> queue;
+    std::unordered_map<int32_t, ImageLoadJob *> jobs; // every job that has not been collected by _LOADIMAGEWAIT yet, by ticket
+    int32_t lastTicket;
+    std::vector<libqb_thread *> workers;
+} g_ImageLoader;
+
+/// @brief Worker thread that decodes queued images until the program ends
+static void image_load_worker(void *) {
+    libqb_mutex_lock(g_ImageLoader.lock);
+
+    for (;;) {
+        while (g_ImageLoader.queue.empty())
+            libqb_condvar_wait(g_ImageLoader.jobQueued, g_ImageLoader.lock);
+
+        auto job = g_ImageLoader.queue.front();
+        g_ImageLoader.queue.pop_front();
+
+        libqb_mutex_unlock(g_ImageLoader.lock);
+        job->pixels = image_decode(job->settings, job->fileNameOrData.data(), job->fileNameOrData.size(), &job->x, &job->y);
+        libqb_mutex_lock(g_ImageLoader.lock);
+
+        job->isDone = true;
+        libqb_condvar_broadcast(g_ImageLoader.jobDone);
+    }
+}
+
+/// @brief Looks up an _LOADIMAGEASYNC ticket. g_ImageLoader.lock must be held
+/// @param ticket A ticket returned by _LOADIMAGEASYNC
+/// @return The job or NULL if the ticket is invalid (an error is raised)
+static ImageLoadJob *image_load_job_get(int32_t ticket) {
+    auto it = g_ImageLoader.jobs.find(ticket);
+    if (it == g_ImageLoader.jobs.end()) {
+        error(QB_ERROR_INVALID_HANDLE);
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+/// @brief Queues an image to be decoded on a background thread. The arguments are the same as _LOADIMAGE
+/// @param qbsFileName The filename or memory buffer (see requirements below) of the image
+/// @param bpp 32 = 32bpp, 33 = 32bpp (hardware accelerated), 256=8bpp or 257=8bpp (without palette remap)
+/// @param qbsRequirements A qbs that can contain one or more of: hardware, memory, adaptive
+/// @param passed How many parameters were passed?
+/// @return A ticket (> 0) for _LOADIMAGEREADY and _LOADIMAGEWAIT or 0 on failure
+int32_t func__loadimageasync(qbs *qbsFileName, int32_t bpp, qbs *qbsRequirements, int32_t passed) {
+    if (new_error)
+        return 0;
+
+    if (!qbsFileName->len) {
+        error(QB_ERROR_BAD_FILE_NAME);
+        return 0;
+    }
+
+    auto job = new ImageLoadJob();
+    if (!image_parse_load_settings(bpp, qbsRequirements, passed, &job->settings)) {
+        delete job;
+        return 0;
+    }
+    job->fileNameOrData.assign(qbsFileName->chr, qbsFileName->chr + qbsFileName->len);
+
+    // Start the worker pool on first use, one worker per core
+    if (g_ImageLoader.workers.empty()) {
+        g_ImageLoader.lock = libqb_mutex_new();
+        g_ImageLoader.jobQueued = libqb_condvar_new();
+        g_ImageLoader.jobDone = libqb_condvar_new();
+
+        auto count = std::max(std::thread::hardware_concurrency(), 1u);
+        image_log_info("Starting %u image loader threads", count);
+        for (unsigned i = 0; i < count; i++) {
+            auto worker = libqb_thread_new();
+            libqb_thread_start(worker, image_load_worker, nullptr);
+            g_ImageLoader.workers.push_back(worker);
+        }
+    }
+
+    libqb_mutex_guard guard(g_ImageLoader.lock);
+
+    if (++g_ImageLoader.lastTicket <= 0)
+        g_ImageLoader.lastTicket = 1;
+    g_ImageLoader.jobs[g_ImageLoader.lastTicket] = job;
+    g_ImageLoader.queue.push_back(job);
+    libqb_condvar_signal(g_ImageLoader.jobQueued);
+
+    return g_ImageLoader.lastTicket;
+}
+
+/// @brief Checks if an image queued by _LOADIMAGEASYNC has been decoded
+/// @param ticket A ticket returned by _LOADIMAGEASYNC
+/// @return -1 if _LOADIMAGEWAIT will return without blocking, 0 otherwise
+int32_t func__loadimageready(int32_t ticket) {
+    if (!g_ImageLoader.lock) {
+        error(QB_ERROR_INVALID_HANDLE);
+        return 0;
+    }
+
+    libqb_mutex_guard guard(g_ImageLoader.lock);
+
+    auto job = image_load_job_get(ticket);
+    return (job && job->isDone) ? -1 : 0;
+}
+
+/// @brief Waits for an image queued by _LOADIMAGEASYNC and creates it. The ticket is invalid after this
+/// @param ticket A ticket returned by _LOADIMAGEASYNC
+/// @return Valid LONG image handle values that are less than -1 or -1 on failure
+int32_t func__loadimagewait(int32_t ticket) {
+    if (!g_ImageLoader.lock) {
+        error(QB_ERROR_INVALID_HANDLE);
+        return INVALID_IMAGE_HANDLE;
+    }
+
+    ImageLoadJob *job;
+    {
+        libqb_mutex_guard guard(g_ImageLoader.lock);
+
+        job = image_load_job_get(ticket);
+        if (!job)
+            return INVALID_IMAGE_HANDLE;
+
+        while (!job->isDone)
+            libqb_condvar_wait(g_ImageLoader.jobDone, g_ImageLoader.lock);
+
+        g_ImageLoader.jobs.erase(ticket);
+    }
+
+    auto handle = INVALID_IMAGE_HANDLE;
+    if (job->pixels)
+        handle = image_create_from_pixels(job->settings, job->pixels, job->x, job->y); // img_struct registration only happens on the BASIC thread
+
+    delete job;
+
+    return handle;
+}
+
+/// @brief A frame being scaled by _SCALEIMAGE. The source rows are split into bands that are converted to RGBA and
+/// then scaled concurrently
+struct ImageScaleJob {
+    ImageScaler scaler;
+    const img_struct *srcImg; // the BGRA or indexed image being scaled
+    uint32_t *src;            // srcImg converted to RGBA pixels, which is what the scalers work on
+    int32_t width, height;
+    uint32_t *dst;
+    int32_t bandRows;       // source rows per band
+    int32_t bandCount;      // total number of bands
+    int32_t nextBand;       // next band waiting to be picked up. [0, bandCount) are converted, [bandCount, 2 * bandCount) scaled
+    int32_t bandsConverted; // bands whose source rows are converted
+    int32_t bandsDone;      // bands that are scaled
+};
+
+/// @brief The worker pool that helps the BASIC thread scale frames for _SCALEIMAGE
+static struct {
+    libqb_mutex *lock;
+    libqb_condvar *bandQueued;
+    libqb_condvar *bandDone;
+    ImageScaleJob *job; // only the BASIC thread queues jobs, so there is at most one at a time
+    std::vector<libqb_thread *> workers;
+    std::vector<uint32_t> pixels; // the RGBA source of the current job, kept so frames of the same size reuse it
+} g_ImageScalerPool;
+
+/// @brief Converts the source rows [yFirst, yLast) of a job from BGRA (or through the palette) to RGBA
+static void image_scale_convert_band(const ImageScaleJob *job, int32_t yFirst, int32_t yLast) {
+    auto first = size_t(job->width) * yFirst;
+    auto last = size_t(job->width) * yLast;
+
+    if (job->srcImg->bits_per_pixel == 32) {
+        for (auto i = first; i < last; i++)
+            job->src[i] = image_swap_red_blue(job->srcImg->offset32[i]);
+    } else {
+        for (auto i = first; i < last; i++)
+            job->src[i] = image_swap_red_blue(job->srcImg->pal[job->srcImg->offset[i]]);
+    }
+}
+
+/// @brief Scales the source rows [yFirst, yLast) of a job. Every scaler reads the rows around the band directly from the whole source image,
+/// so the bands need no overlap of their own and write to disjoint parts of the output
+static void image_scale_band(const ImageScaleJob *job, int32_t yFirst, int32_t yLast) {
+    switch (job->scaler) {
+    case ImageScaler::SXBR2:
+        scaleSuperXBR2(job->src, job->width, job->height, job->dst, yFirst, yLast);
+        break;
+
+    case ImageScaler::SXBR3:
+        scaleSuperXBR3(job->src, job->width, job->height, job->dst, yFirst, yLast);
+        break;
+
+    case ImageScaler::SXBR4:
+        scaleSuperXBR4(job->src, job->width, job->height, job->dst, yFirst, yLast);
+        break;
+
+    case ImageScaler::MMPX2:
+        mmpx_scale2x(job->src, job->dst, job->width, job->height, yFirst, yLast);
+        break;
+
+    case ImageScaler::HQ2XA:
+        hq2xA(job->src, job->width, job->height, job->dst, yFirst, yLast);
+        break;
+
+    case ImageScaler::HQ2XB:
+        hq2xB(job->src, job->width, job->height, job->dst, yFirst, yLast);
+        break;
+
+    case ImageScaler::HQ3XA:
+        hq3xA(job->src, job->width, job->height, job->dst, yFirst, yLast);
+        break;
+
+    case ImageScaler::HQ3XB:
+        hq3xB(job->src, job->width, job->height, job->dst, yFirst, yLast);
+        break;
+
+    default: // NONE
+        memcpy(job->dst + size_t(job->width) * yFirst, job->src + size_t(job->width) * yFirst, sizeof(uint32_t) * job->width * (yLast - yFirst));
+    }
+}
+
+/// @brief Picks up and converts or scales bands of the current job until none are left. g_ImageScalerPool.lock must be held
+static void image_scale_run_bands() {
+    auto job = g_ImageScalerPool.job;
+    auto factor = g_ImageScaleFactor[size_t(job->scaler)];
+
+    while (job->nextBand < job->bandCount * 2) {
+        auto band = job->nextBand++;
+        auto converting = band < job->bandCount;
+
+        if (!converting) {
+            // The scalers read the rows around their band too, so every band has to be converted first. All of them
+            // are picked up by now, so this only waits for the ones still being converted
+            while (job->bandsConverted < job->bandCount)
+                libqb_condvar_wait(g_ImageScalerPool.bandDone, g_ImageScalerPool.lock);
+
+            band -= job->bandCount;
+        }
+
+        libqb_mutex_unlock(g_ImageScalerPool.lock);
+        auto yFirst = band * job->bandRows;
+        auto yLast = std::min(yFirst + job->bandRows, job->height);
+        if (converting) {
+            image_scale_convert_band(job, yFirst, yLast);
+        } else {
+            image_scale_band(job, yFirst, yLast);
+
+            // Back to BGRA while the band's output is still in the cache
+            auto rowPixels = size_t(job->width) * factor * factor;
+            image_swap_red_blue_buffer(job->dst + rowPixels * yFirst, rowPixels * (yLast - yFirst));
+        }
+        libqb_mutex_lock(g_ImageScalerPool.lock);
+
+        if (converting) {
+            if (++job->bandsConverted == job->bandCount)
+                libqb_condvar_broadcast(g_ImageScalerPool.bandDone);
+        } else if (++job->bandsDone == job->bandCount) {
+            libqb_condvar_broadcast(g_ImageScalerPool.bandDone);
+        }
+    }
+}
+
+/// @brief Worker thread that scales bands queued by _SCALEIMAGE until the program ends
+static void image_scale_worker(void *) {
+    libqb_mutex_lock(g_ImageScalerPool.lock);
+
+    for (;;) {
+        while (!g_ImageScalerPool.job || g_ImageScalerPool.job->nextBand >= g_ImageScalerPool.job->bandCount * 2)
+            libqb_condvar_wait(g_ImageScalerPool.bandQueued, g_ImageScalerPool.lock);
+
+        image_scale_run_bands();
+    }
+}
+
+/// @brief Scales the pixels of a graphics image into a 32bpp image of exactly the scaled size with the worker pool. The
+/// calling thread works on bands too and returns once the whole frame is done
+/// @param src The source img index. It can be 32bpp or indexed
+/// @param dst The destination img index
+/// @param scaler The scaler algorithm to use
+static void image_scale_into(int32_t src, int32_t dst, ImageScaler scaler) {
+    auto width = img[src].width;
+    auto height = img[src].height;
+
+    // Small frames are not worth waking anyone up for
+    constexpr auto minBandRows = 16;
+
+    // Start the worker pool on first use. The BASIC thread is one of the workers
+    if (!g_ImageScalerPool.lock) {
+        g_ImageScalerPool.lock = libqb_mutex_new();
+        g_ImageScalerPool.bandQueued = libqb_condvar_new();
+        g_ImageScalerPool.bandDone = libqb_condvar_new();
+
+        auto count = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+        image_log_info("Starting %u image scaler threads", count);
+        for (unsigned i = 0; i < count; i++) {
+            auto worker = libqb_thread_new();
+            libqb_thread_start(worker, image_scale_worker, nullptr);
+            g_ImageScalerPool.workers.push_back(worker);
+        }
+    }
+
+    // The scalers work on RGBA pixels like the ones _LOADIMAGE feeds them, so the bands convert the source into this
+    // first and their output back to BGRA
+    g_ImageScalerPool.pixels.resize(size_t(width) * height);
+
+    ImageScaleJob job;
+    job.scaler = scaler;
+    job.srcImg = &img[src];
+    job.src = g_ImageScalerPool.pixels.data();
+    job.width = width;
+    job.height = height;
+    job.dst = img[dst].offset32;
+    job.bandCount = std::max(std::min(int32_t(g_ImageScalerPool.workers.size() + 1), height / minBandRows), 1);
+    job.bandRows = (height + job.bandCount - 1) / job.bandCount;
+    job.bandCount = (height + job.bandRows - 1) / job.bandRows;
+    job.nextBand = 0;
+    job.bandsConverted = 0;
+    job.bandsDone = 0;
+
+    image_log_trace("Scaler %i: (%i x %i) in %i band(s)", (int)scaler, width, height, job.bandCount);
+
+    libqb_mutex_guard guard(g_ImageScalerPool.lock);
+
+    g_ImageScalerPool.job = &job;
+    if (job.bandCount > 1)
+        libqb_condvar_broadcast(g_ImageScalerPool.bandQueued);
+
+    image_scale_run_bands();
+
+    while (job.bandsDone < job.bandCount)
+        libqb_condvar_wait(g_ImageScalerPool.bandDone, g_ImageScalerPool.lock);
+
+    g_ImageScalerPool.job = nullptr;
+}
+
+/// @brief Resolves an image or page handle passed from BASIC
+/// @param imageHandle An image handle (< -1) or a screen page number (>= 0)
+/// @return The img index or 0 on failure (an error is raised)
+static int32_t image_get_index(int32_t imageHandle) {
+    if (imageHandle >= 0) {
+        validatepage(imageHandle);
+        return new_error ? 0 : page[imageHandle];
+    }
+
+    imageHandle = -imageHandle;
+    if (imageHandle >= nextimg || !img[imageHandle].valid) {
+        error(QB_ERROR_INVALID_HANDLE);
+        return 0;
+    }
+
+    return imageHandle;
+}
+
+/// @brief Parses the scaler name passed to _SCALEIMAGE
+/// @param qbsScaler One of the _LOADIMAGE scaler names (e.g. "hq2xa"). "NONE" is not accepted
+/// @param scaler Out: the scaler
+/// @return True if the name was valid (an error is raised otherwise)
+static bool image_parse_scaler_name(qbs *qbsScaler, ImageScaler *scaler) {
+    std::string name(reinterpret_cast<char *>(qbsScaler->chr), qbsScaler->len);
+    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+
+    // Skip ImageScaler::NONE, scaling by a factor of one is just a copy
+    for (size_t i = size_t(ImageScaler::NONE) + 1; i < _countof(g_ImageScalerName); i++) {
+        if (name.find(g_ImageScalerName[i]) != std::string::npos) {
+            *scaler = (ImageScaler)i;
+            return true;
+        }
+    }
+
+    image_log_error("Unknown scaler: %s", name.c_str());
+    error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
+    return false;
+}
+
+/// @brief Scales an image into another 32bpp image using one of the pixel art scalers. This is meant to be called every frame
+/// @param srcHandle The source image handle or page. Text surfaces are not supported
+/// @param dstHandle The destination image handle or page. It must be a 32bpp image exactly scale factor times the size of the source
+/// @param qbsScaler The scaler name: SXBR2, SXBR3, SXBR4, MMPX2, HQ2XA, HQ2XB, HQ3XA or HQ3XB
+void sub__scaleimage(int32_t srcHandle, int32_t dstHandle, qbs *qbsScaler) {
+    if (new_error)
+        return;
+
+    ImageScaler scaler;
+    if (!image_parse_scaler_name(qbsScaler, &scaler))
+        return;
+
+    auto src = image_get_index(srcHandle);
+    if (!src)
+        return;
+
+    auto dst = image_get_index(dstHandle);
+    if (!dst)
+        return;
+
+    auto factor = g_ImageScaleFactor[size_t(scaler)];
+
+    if (src == dst || img[src].text || img[dst].text || img[dst].bits_per_pixel != 32 || img[dst].width != img[src].width * factor ||
+        img[dst].height != img[src].height * factor) {
+        error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
+        return;
+    }
+
+    image_scale_into(src, dst, scaler);
+}
+
+/// @brief Creates a new 32bpp image from an image using one of the pixel art scalers
+/// @param srcHandle The source image handle or page. Text surfaces are not supported
+/// @param qbsScaler The scaler name: SXBR2, SXBR3, SXBR4, MMPX2, HQ2XA, HQ2XB, HQ3XA or HQ3XB
+/// @return Valid LONG image handle values that are less than -1 or -1 on failure
+int32_t func__scaleimage(int32_t srcHandle, qbs *qbsScaler) {
+    if (new_error)
+        return INVALID_IMAGE_HANDLE;
+
+    ImageScaler scaler;
+    if (!image_parse_scaler_name(qbsScaler, &scaler))
+        return INVALID_IMAGE_HANDLE;
+
+    auto src = image_get_index(srcHandle);
+    if (!src)
+        return INVALID_IMAGE_HANDLE;
+
+    if (img[src].text) {
+        error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
+        return INVALID_IMAGE_HANDLE;
+    }
+
+    auto factor = g_ImageScaleFactor[size_t(scaler)];
+
+    auto i = func__newimage(img[src].width * factor, img[src].height * factor, 32, 1);
+    if (i == INVALID_IMAGE_HANDLE)
+        return INVALID_IMAGE_HANDLE;
+
+    image_scale_into(src, -i, scaler);
+
+    return i;
+}
+
 /// @brief Saves an image to the disk from a QB64-PE image handle
 /// @param qbsFileName The file path name to save to
 /// @param imageHandle Optional: The image handle. If omitted, then this is _DISPLAY()
@@ -854,6 +1326,7 @@ void sub__saveimage(qbs *qbsFileName, int32_t imageHandle, qbs *qbsRequirements,
     image_log_trace("Using image handle %i", imageHandle);
 
     auto format = SaveFormat::PNG; // we always default to PNG
+    auto pngLevel = PNG_WRITE_DEFAULT_LEVEL;
 
     if ((passed & 2) && qbsRequirements->len) {
         // Parse the requirements string and setup save settings
@@ -862,6 +1335,19 @@ void sub__saveimage(qbs *qbsFileName, int32_t imageHandle, qbs *qbsRequirements,
 
         image_log_trace("Parsing requirements string: %s", requirements.c_str());
 
+        // PNG compression level: "level=n" (or "level:n" / "level n") where n is 0 (fastest) to 9 (smallest)
+        auto levelPos = requirements.find("level");
+        if (levelPos != std::string::npos) {
+            levelPos += 5;
+            while (levelPos < requirements.length() && (requirements[levelPos] == '=' || requirements[levelPos] == ':' || requirements[levelPos] == ' '))
+                ++levelPos;
+
+            if (levelPos < requirements.length() && isdigit(requirements[levelPos])) {
+                pngLevel = std::min(atoi(requirements.c_str() + levelPos), PNG_WRITE_MAX_LEVEL);
+                image_log_trace("PNG compression level: %i", pngLevel);
+            }
+        }
+
         for (size_t i = 0; i < _countof(formatName); i++) {
             image_log_trace("Checking for: %s", formatName[i]);
             if (requirements.find(formatName[i]) != std::string::npos) {
@@ -996,9 +1482,8 @@ void sub__saveimage(qbs *qbsFileName, int32_t imageHandle, qbs *qbsRequirements,
 
     switch (format) {
     case SaveFormat::PNG: {
-        stbi_write_png_compression_level = 100;
-        if (!stbi_write_png(fileName.c_str(), width, height, sizeof(uint32_t), pixels.data(), 0)) {
-            image_log_error("stbi_write_png() failed");
+        if (!png_write_file(fileName.c_str(), pixels.data(), width, height, pngLevel)) {
+            image_log_error("png_write_file() failed");
             error(QB_ERROR_ILLEGAL_FUNCTION_CALL);
         }
     } break;
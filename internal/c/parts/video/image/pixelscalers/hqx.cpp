@@ -20,6 +20,8 @@
 #include <cstdint>
 #include <cstdlib>
 
+#include "pixelscalers.h"
+
 #define MASK_RB 0x00FF00FF
 #define MASK_G 0x0000FF00
 #define MASK_A 0xFF000000
@@ -192,7 +194,7 @@ static inline bool isDifferentB(uint32_t color1, uint32_t color2, uint32_t trY,
 }
 
 static uint32_t *hq2x_resize(char mode, const uint32_t *image, uint32_t width, uint32_t height, uint32_t *output, uint32_t trY, uint32_t trU, uint32_t trV,
-                             uint32_t trA, bool wrapX, bool wrapY) {
+                             uint32_t trA, bool wrapX, bool wrapY, uint32_t rowFirst, uint32_t rowLast) {
     bool (*isDifferent)(uint32_t color1, uint32_t color2, uint32_t trY, uint32_t trU, uint32_t trV, uint32_t trA) = &isDifferentA;
     if (mode == 'B') {
         isDifferent = &isDifferentB;
@@ -207,8 +209,14 @@ static uint32_t *hq2x_resize(char mode, const uint32_t *image, uint32_t width, u
     trU <<= 8;
     trA <<= 24;
 
+    // only the rows [rowFirst, rowLast) are scaled; the rows around them are still read so bands can be scaled independently
+    if (rowLast > height)
+        rowLast = height;
+    image += size_t(rowFirst) * width;
+    output += size_t(rowFirst) * lineSize * 2;
+
     // iterates between the lines
-    for (uint32_t row = 0; row < height; row++) {
+    for (uint32_t row = rowFirst; row < rowLast; row++) {
         /*
          * Note: this function uses a 3x3 sliding window over the original image.
          *
@@ -2084,7 +2092,7 @@ static uint32_t *hq2x_resize(char mode, const uint32_t *image, uint32_t width, u
 }
 
 static uint32_t *hq3x_resize(char mode, const uint32_t *image, uint32_t width, uint32_t height, uint32_t *output, uint32_t trY, uint32_t trU, uint32_t trV,
-                             uint32_t trA, bool wrapX, bool wrapY) {
+                             uint32_t trA, bool wrapX, bool wrapY, uint32_t rowFirst, uint32_t rowLast) {
     bool (*isDifferent)(uint32_t color1, uint32_t color2, uint32_t trY, uint32_t trU, uint32_t trV, uint32_t trA) = &isDifferentA;
     if (mode == 'B') {
         isDifferent = &isDifferentB;
@@ -2099,8 +2107,14 @@ static uint32_t *hq3x_resize(char mode, const uint32_t *image, uint32_t width, u
     trU <<= 8;
     trA <<= 24;
 
+    // only the rows [rowFirst, rowLast) are scaled; the rows around them are still read so bands can be scaled independently
+    if (rowLast > height)
+        rowLast = height;
+    image += size_t(rowFirst) * width;
+    output += size_t(rowFirst) * lineSize * 3;
+
     // iterates between the lines
-    for (uint32_t row = 0; row < height; row++) {
+    for (uint32_t row = rowFirst; row < rowLast; row++) {
         /*
          * Note: this function uses a 3x3 sliding window over the original image.
          *
@@ -4964,18 +4978,18 @@ static uint32_t *hq3x_resize(char mode, const uint32_t *image, uint32_t width, u
 // The constant values supplied for the trailing arguments were provided
 // as default values in the original impl.
 
-void hq2xA(uint32_t *img, int w, int h, uint32_t *out) {
-    hq2x_resize('A', img, w, h, out, 0x30, 0x07, 0x06, 0x50, false, false);
+void hq2xA(uint32_t *img, int w, int h, uint32_t *out, int yFirst, int yLast) {
+    hq2x_resize('A', img, w, h, out, 0x30, 0x07, 0x06, 0x50, false, false, yFirst, yLast);
 }
 
-void hq2xB(uint32_t *img, int w, int h, uint32_t *out) {
-    hq2x_resize('B', img, w, h, out, 0x30, 0x07, 0x06, 0x50, false, false);
+void hq2xB(uint32_t *img, int w, int h, uint32_t *out, int yFirst, int yLast) {
+    hq2x_resize('B', img, w, h, out, 0x30, 0x07, 0x06, 0x50, false, false, yFirst, yLast);
 }
 
-void hq3xA(uint32_t *img, int w, int h, uint32_t *out) {
-    hq3x_resize('A', img, w, h, out, 0x30, 0x07, 0x06, 0x50, false, false);
+void hq3xA(uint32_t *img, int w, int h, uint32_t *out, int yFirst, int yLast) {
+    hq3x_resize('A', img, w, h, out, 0x30, 0x07, 0x06, 0x50, false, false, yFirst, yLast);
 }
 
-void hq3xB(uint32_t *img, int w, int h, uint32_t *out) {
-    hq3x_resize('B', img, w, h, out, 0x30, 0x07, 0x06, 0x50, false, false);
+void hq3xB(uint32_t *img, int w, int h, uint32_t *out, int yFirst, int yLast) {
+    hq3x_resize('B', img, w, h, out, 0x30, 0x07, 0x06, 0x50, false, false, yFirst, yLast);
 }
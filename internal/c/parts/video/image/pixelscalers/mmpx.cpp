@@ -8,6 +8,8 @@
 #include <cstdbool>
 #include <cstdint>
 
+#include "pixelscalers.h"
+
 static inline constexpr uint32_t luma(uint32_t color) {
     const uint32_t alpha = (color & 0xFF000000) >> 24;
     return (((color & 0x00FF0000) >> 16) + ((color & 0x0000FF00) >> 8) + (color & 0x000000FF) + 1) * (256 - alpha);
@@ -65,10 +67,12 @@ static struct Meta build_meta(const uint32_t *srcBuffer, uint32_t srcWidth, uint
     };
 }
 
-void mmpx_scale2x(const uint32_t *srcBuffer, uint32_t *dst, uint32_t srcWidth, uint32_t srcHeight) {
+void mmpx_scale2x(const uint32_t *srcBuffer, uint32_t *dst, uint32_t srcWidth, uint32_t srcHeight, uint32_t srcYFirst, uint32_t srcYLast) {
     const struct Meta meta = build_meta(srcBuffer, srcWidth, srcHeight);
 
-    for (uint32_t srcY = 0; srcY < srcHeight; ++srcY) {
+    srcYLast = std::min(srcYLast, srcHeight);
+
+    for (uint32_t srcY = srcYFirst; srcY < srcYLast; ++srcY) {
         uint32_t srcX = 0;
 
         // Inputs carried along rows
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <climits>
 #include <cstdint>
 
-void hq2xA(uint32_t *img, int w, int h, uint32_t *out);
-void hq2xB(uint32_t *img, int w, int h, uint32_t *out);
-void hq3xA(uint32_t *img, int w, int h, uint32_t *out);
-void hq3xB(uint32_t *img, int w, int h, uint32_t *out);
-void mmpx_scale2x(const uint32_t *srcBuffer, uint32_t *dst, uint32_t srcWidth, uint32_t srcHeight);
-void scaleSuperXBR2(uint32_t *data, int w, int h, uint32_t *out);
-void scaleSuperXBR3(uint32_t *data, int w, int h, uint32_t *out);
-void scaleSuperXBR4(uint32_t *data, int w, int h, uint32_t *out);
+// All scalers can optionally work on a band of source rows [yFirst, yLast). Rows outside the band are still read as
+// neighbours, so separate bands of the same image can be scaled concurrently into the same output buffer
+void hq2xA(uint32_t *img, int w, int h, uint32_t *out, int yFirst = 0, int yLast = INT_MAX);
+void hq2xB(uint32_t *img, int w, int h, uint32_t *out, int yFirst = 0, int yLast = INT_MAX);
+void hq3xA(uint32_t *img, int w, int h, uint32_t *out, int yFirst = 0, int yLast = INT_MAX);
+void hq3xB(uint32_t *img, int w, int h, uint32_t *out, int yFirst = 0, int yLast = INT_MAX);
+void mmpx_scale2x(const uint32_t *srcBuffer, uint32_t *dst, uint32_t srcWidth, uint32_t srcHeight, uint32_t srcYFirst = 0, uint32_t srcYLast = UINT32_MAX);
+void scaleSuperXBR2(uint32_t *data, int w, int h, uint32_t *out, int yFirst = 0, int yLast = INT_MAX);
+void scaleSuperXBR3(uint32_t *data, int w, int h, uint32_t *out, int yFirst = 0, int yLast = INT_MAX);
+void scaleSuperXBR4(uint32_t *data, int w, int h, uint32_t *out, int yFirst = 0, int yLast = INT_MAX);
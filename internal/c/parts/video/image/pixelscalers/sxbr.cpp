@@ -17,6 +17,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "pixelscalers.h"
+
 typedef struct ScalerCfg {
     double luminanceWeight;
     double equalColorTolerance;
@@ -727,14 +729,14 @@ static void scaleImage(ScalerTypeVTable *scaler, uint32_t *src, uint32_t *trg, i
     }
 }
 
-void scaleSuperXBR2(uint32_t *data, int w, int h, uint32_t *out) {
-    scaleImage(&scaler2x_vtable, data, out, w, h, &default_scaler_cfg, 0, INT_MAX);
+void scaleSuperXBR2(uint32_t *data, int w, int h, uint32_t *out, int yFirst, int yLast) {
+    scaleImage(&scaler2x_vtable, data, out, w, h, &default_scaler_cfg, yFirst, yLast);
 }
 
-void scaleSuperXBR3(uint32_t *data, int w, int h, uint32_t *out) {
-    scaleImage(&scaler3x_vtable, data, out, w, h, &default_scaler_cfg, 0, INT_MAX);
+void scaleSuperXBR3(uint32_t *data, int w, int h, uint32_t *out, int yFirst, int yLast) {
+    scaleImage(&scaler3x_vtable, data, out, w, h, &default_scaler_cfg, yFirst, yLast);
 }
 
-void scaleSuperXBR4(uint32_t *data, int w, int h, uint32_t *out) {
-    scaleImage(&scaler4x_vtable, data, out, w, h, &default_scaler_cfg, 0, INT_MAX);
+void scaleSuperXBR4(uint32_t *data, int w, int h, uint32_t *out, int yFirst, int yLast) {
+    scaleImage(&scaler4x_vtable, data, out, w, h, &default_scaler_cfg, yFirst, yLast);
 }
@@ -0,0 +1,268 @@
+//-----------------------------------------------------------------------------------------------------
+// PNG writer for QB64-PE
+//
+// References:
+// https://www.w3.org/TR/png/
+// http://www.libpng.org/pub/png/book/chapter09.html
+//-----------------------------------------------------------------------------------------------------
+
+#include "libqb-common.h"
+
+#include "../../../data/miniz.h"
+#include "image.h"
+#include "png_write.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+class PNGWriter {
+    static constexpr auto BYTES_PER_PIXEL = 4;     // we always write 8-bit RGBA
+    static constexpr auto ROWS_PER_THREAD_MIN = 64; // bands smaller than this are not worth a thread
+
+    enum Filter : uint8_t { None = 0, Sub, Up, Average, Paeth, Count };
+
+    static inline uint8_t PaethPredictor(int a, int b, int c) {
+        auto p = a + b - c;
+        auto pa = std::abs(p - a);
+        auto pb = std::abs(p - b);
+        auto pc = std::abs(p - c);
+
+        if (pa <= pb && pa <= pc)
+            return uint8_t(a);
+
+        if (pb <= pc)
+            return uint8_t(b);
+
+        return uint8_t(c);
+    }
+
+    /// @brief Applies one filter to a scanline
+    /// @param filter The filter type
+    /// @param row The current unfiltered scanline
+    /// @param prior The previous unfiltered scanline (all zeros for the first row)
+    /// @param stride The number of bytes in a scanline
+    /// @param out The destination for the filtered bytes
+    /// @return The sum of the filtered bytes taken as signed values (the usual "minimum sum of absolute differences" heuristic)
+    static uint32_t FilterRow(Filter filter, const uint8_t *row, const uint8_t *prior, size_t stride, uint8_t *out) {
+        size_t i = 0;
+
+        switch (filter) {
+        case Filter::Sub:
+            for (; i < BYTES_PER_PIXEL; i++)
+                out[i] = row[i];
+            for (; i < stride; i++)
+                out[i] = uint8_t(row[i] - row[i - BYTES_PER_PIXEL]);
+            break;
+
+        case Filter::Up:
+            for (; i < stride; i++)
+                out[i] = uint8_t(row[i] - prior[i]);
+            break;
+
+        case Filter::Average:
+            for (; i < BYTES_PER_PIXEL; i++)
+                out[i] = uint8_t(row[i] - (prior[i] >> 1));
+            for (; i < stride; i++)
+                out[i] = uint8_t(row[i] - ((row[i - BYTES_PER_PIXEL] + prior[i]) >> 1));
+            break;
+
+        case Filter::Paeth:
+            for (; i < BYTES_PER_PIXEL; i++)
+                out[i] = uint8_t(row[i] - prior[i]); // PaethPredictor(0, b, 0) == b
+            for (; i < stride; i++)
+                out[i] = uint8_t(row[i] - PaethPredictor(row[i - BYTES_PER_PIXEL], prior[i], prior[i - BYTES_PER_PIXEL]));
+            break;
+
+        default:
+            memcpy(out, row, stride);
+        }
+
+        uint32_t sum = 0;
+        for (i = 0; i < stride; i++)
+            sum += uint32_t(std::abs(int(int8_t(out[i]))));
+
+        return sum;
+    }
+
+    /// @brief Filters the scanlines [startRow, endRow) picking the cheapest filter for each row
+    static void FilterRows(const uint8_t *image, size_t stride, int32_t startRow, int32_t endRow, bool tryFilters, uint8_t *out) {
+        std::vector<uint8_t> candidate(stride);
+        std::vector<uint8_t> zeroRow(stride);
+
+        for (auto y = startRow; y < endRow; y++) {
+            auto row = image + stride * y;
+            auto prior = y ? row - stride : zeroRow.data();
+            auto dst = out + (stride + 1) * y;
+
+            dst[0] = Filter::None;
+
+            if (!tryFilters) {
+                memcpy(dst + 1, row, stride);
+                continue;
+            }
+
+            auto bestSum = FilterRow(Filter::None, row, prior, stride, dst + 1);
+
+            for (auto f = int(Filter::Sub); f < Filter::Count; f++) {
+                auto sum = FilterRow(Filter(f), row, prior, stride, candidate.data());
+                if (sum < bestSum) {
+                    bestSum = sum;
+                    dst[0] = uint8_t(f);
+                    memcpy(dst + 1, candidate.data(), stride);
+                }
+            }
+        }
+    }
+
+    static void WriteU32BE(uint8_t *dst, uint32_t value) {
+        dst[0] = uint8_t(value >> 24);
+        dst[1] = uint8_t(value >> 16);
+        dst[2] = uint8_t(value >> 8);
+        dst[3] = uint8_t(value);
+    }
+
+    static bool WriteChunk(FILE *file, const char *type, const void *data, uint32_t size) {
+        uint8_t header[8];
+        WriteU32BE(header, size);
+        memcpy(header + 4, type, 4);
+
+        auto crc = mz_crc32(MZ_CRC32_INIT, header + 4, 4);
+        if (size)
+            crc = mz_crc32(crc, reinterpret_cast<const uint8_t *>(data), size);
+
+        uint8_t footer[4];
+        WriteU32BE(footer, uint32_t(crc));
+
+        return fwrite(header, 1, sizeof(header), file) == sizeof(header) && (!size || fwrite(data, 1, size, file) == size) &&
+               fwrite(footer, 1, sizeof(footer), file) == sizeof(footer);
+    }
+
+    /// @brief miniz output callback. Every block of compressed data becomes one IDAT chunk
+    static mz_bool WriteIDAT(const void *data, int len, void *user) {
+        return WriteChunk(reinterpret_cast<FILE *>(user), "IDAT", data, uint32_t(len)) ? MZ_TRUE : MZ_FALSE;
+    }
+
+    /// @brief Writes the data as a zlib stream made of stored (uncompressed) deflate blocks, one IDAT chunk per block.
+    /// This is what level 0 asks for and is a lot cheaper than pushing the data through the compressor
+    static bool WriteStoredIDAT(FILE *file, const uint8_t *data, size_t size) {
+        static constexpr size_t STORED_BLOCK_MAX = 65535;
+
+        std::vector<uint8_t> block(2 + 5 + STORED_BLOCK_MAX + 4);
+
+        // zlib header: deflate with a 32K window, no preset dictionary, "fastest" compression hint
+        block[0] = 0x78;
+        block[1] = 0x01;
+        size_t headerSize = 2;
+
+        mz_ulong adler = MZ_ADLER32_INIT;
+        size_t offset = 0;
+
+        do {
+            auto len = std::min(size - offset, STORED_BLOCK_MAX);
+            auto last = offset + len == size;
+            auto p = block.data() + headerSize;
+
+            p[0] = last ? 1 : 0; // BFINAL + BTYPE 00
+            p[1] = uint8_t(len);
+            p[2] = uint8_t(len >> 8);
+            p[3] = uint8_t(~len);
+            p[4] = uint8_t(~len >> 8);
+            memcpy(p + 5, data + offset, len);
+
+            adler = mz_adler32(adler, data + offset, len);
+            auto chunkSize = headerSize + 5 + len;
+
+            if (last) {
+                WriteU32BE(block.data() + chunkSize, uint32_t(adler));
+                chunkSize += 4;
+            }
+
+            if (!WriteChunk(file, "IDAT", block.data(), uint32_t(chunkSize)))
+                return false;
+
+            headerSize = 0;
+            offset += len;
+        } while (offset < size);
+
+        return true;
+    }
+
+  public:
+    static bool WriteToFile(const char *fileName, const uint32_t *pixels, int32_t width, int32_t height, int level) {
+        level = std::clamp(level, 0, PNG_WRITE_MAX_LEVEL);
+
+        auto image = reinterpret_cast<const uint8_t *>(pixels);
+        auto stride = size_t(width) * BYTES_PER_PIXEL;
+        auto tryFilters = level > 0; // stored blocks gain nothing from filtering
+
+        std::vector<uint8_t> filtered((stride + 1) * height);
+
+        // Filter selection only looks at the current and the previous unfiltered row so bands of rows are independent
+        auto threadCount = std::max(std::min<int32_t>(int32_t(std::thread::hardware_concurrency()), height / ROWS_PER_THREAD_MIN), 1);
+        auto rowsPerThread = (height + threadCount - 1) / threadCount;
+
+        image_log_trace("Filtering %i rows on %i thread(s)", height, threadCount);
+
+        std::vector<std::thread> workers;
+        for (auto i = 1; i < threadCount; i++) {
+            auto startRow = rowsPerThread * i;
+            auto endRow = std::min(startRow + rowsPerThread, height);
+            workers.emplace_back(FilterRows, image, stride, startRow, endRow, tryFilters, filtered.data());
+        }
+
+        FilterRows(image, stride, 0, std::min(rowsPerThread, height), tryFilters, filtered.data());
+
+        for (auto &worker : workers)
+            worker.join();
+
+        auto file = fopen(fileName, "wb");
+        if (!file) {
+            image_log_error("Failed to open %s", fileName);
+            return false;
+        }
+
+        static const uint8_t signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+        uint8_t ihdr[13];
+        WriteU32BE(ihdr, uint32_t(width));
+        WriteU32BE(ihdr + 4, uint32_t(height));
+        ihdr[8] = 8;  // bit depth
+        ihdr[9] = 6;  // color type: RGBA
+        ihdr[10] = 0; // compression method: deflate
+        ihdr[11] = 0; // filter method: adaptive
+        ihdr[12] = 0; // interlace method: none
+
+        auto success = fwrite(signature, 1, sizeof(signature), file) == sizeof(signature) && WriteChunk(file, "IHDR", ihdr, sizeof(ihdr));
+
+        if (success) {
+            if (level) {
+                auto flags = tdefl_create_comp_flags_from_zip_params(level, MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY);
+                success = tdefl_compress_mem_to_output(filtered.data(), filtered.size(), WriteIDAT, file, int(flags));
+            } else {
+                success = WriteStoredIDAT(file, filtered.data(), filtered.size());
+            }
+        }
+
+        success = success && WriteChunk(file, "IEND", nullptr, 0);
+
+        if (fclose(file))
+            success = false;
+
+        if (!success)
+            image_log_error("Failed to write %s", fileName);
+
+        return success;
+    }
+};
+
+bool png_write_file(const char *fileName, const uint32_t *pixels, int32_t width, int32_t height, int level) {
+    if (!fileName || !fileName[0] || !pixels || width < 1 || height < 1) {
+        image_log_warn("Invalid parameters");
+        return false;
+    }
+
+    return PNGWriter::WriteToFile(fileName, pixels, width, height, level);
+}
@@ -0,0 +1,27 @@
+//-----------------------------------------------------------------------------------------------------
+// PNG writer for QB64-PE
+//
+// Per-row filter selection runs in parallel across rows and the filtered scanlines are deflated by miniz.
+//
+// References:
+// https://www.w3.org/TR/png/
+// http://www.libpng.org/pub/png/book/chapter09.html
+//-----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+/// @brief Default deflate level used when the caller does not ask for one (same as zlib's default)
+static constexpr int PNG_WRITE_DEFAULT_LEVEL = 6;
+/// @brief Highest deflate level accepted by png_write_file()
+static constexpr int PNG_WRITE_MAX_LEVEL = 9;
+
+/// @brief Writes 8-bit RGBA pixels to a PNG file
+/// @param fileName The file path name to write to
+/// @param pixels The RGBA pixel data (width * height entries, top row first)
+/// @param width The width of the image in pixels
+/// @param height The height of the image in pixels
+/// @param level The deflate level, 0 (stored) to PNG_WRITE_MAX_LEVEL (smallest). Out of range values are clamped
+/// @return True on success
+bool png_write_file(const char *fileName, const uint32_t *pixels, int32_t width, int32_t height, int level);
@@ -1,58 +1,14 @@
-#include "audio.h"
-#include "bitops.h"
-#include "clipboard.h"
-#include "command.h"
-#include "common.h"
-#include "compression.h"
-#include "datetime.h"
-#include "encoding.h"
-#include "environ.h"
-#include "error_handle.h"
-#include "event.h"
-#include "extended_math.h"
-#include "file-fields.h"
-#include "filepath.h"
-#include "filesystem.h"
-#include "font.h"
-#include "game_controller.h"
-#include "graphics.h"
-#include "gui.h"
-#include "hashing.h"
-#include "hexoctbin.h"
-#include "image.h"
-#include "libqb.h"
-#include "logging.h"
-#include "memblock.h"
-#include "qbmath.h"
-#include "qbs-mk-cv.h"
-#include "qbs.h"
-#include "rounding.h"
-#include "shell.h"
-
-extern int32 func__cinp(int32 toggle, int32 passed); // Console INP scan code reader
-extern int func__capslock();
-extern int func__scrolllock();
-extern int func__numlock();
-extern void sub__capslock(int32 options);
-extern void sub__scrolllock(int32 options);
-extern void sub__numlock(int32 options);
-extern void sub__consolefont(qbs *FontName, int FontSize);
-extern void sub__console_cursor(int32 visible, int32 cursorsize, int32 passed);
-extern int32 func__getconsoleinput();
-
-extern void unlockvWatchHandle();
-extern int32 vWatchHandle();
-
-#ifdef QB64_MACOSX
-#    include <ApplicationServices/ApplicationServices.h>
-#endif
+#include "qbx.h"
+
+#include "condvar.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
 
 #ifdef QB64_WINDOWS
 int _CRT_glob = -1; // enable globbing on llvm-mingw by default
 #endif
 
-extern int32 sub_gl_called;
-
 #ifdef QB64_GUI
 #    ifdef DEPENDENCY_GL
 
@@ -72,298 +28,11 @@ void gluPerspective(double fovy, double aspect, double zNear, double zFar) {
 #    endif
 #endif
 
-// forward references
-void QBMAIN(void *);
-void TIMERTHREAD(void *);
-
-extern int32 requestedKeyboardOverlayImage;
-
 void requestKeyboardOverlayImage(int32 handle) {
     requestedKeyboardOverlayImage = handle;
 }
 
-// extern functions
-
-extern int32 func__scaledwidth();
-extern int32 func__scaledheight();
-
-extern void sub__fps(double fps, int32 passed);
-
-extern void sub__resize(int32 on_off, int32 stretch_smooth);
-extern int32 func__resize();
-extern int32 func__resizewidth();
-extern int32 func__resizeheight();
-
-extern void sub__title(qbs *title);
-extern void sub__echo(qbs *message);
-extern qbs *func__readfile(qbs *filespec);
-extern void sub__writefile(qbs *filespec, qbs *contents);
-extern void sub__assert(int32 expression, qbs *assert_message, int32 passed);
-extern void sub__finishdrop();
-extern int32 func__filedrop();
-extern void sub__filedrop(int32 on_off = NULL);
-extern int32 func__totaldroppedfiles();
-extern qbs *func__droppedfile(int32 fileIndex, int32 passed);
-
-extern qbs *func__embedded(qbs *handle);
-
-extern void sub__glrender(int32 method);
-extern void sub__displayorder(int32 method1, int32 method2, int32 method3, int32 method4);
-
-extern int64 GetTicks();
-
-extern mem_block func__memimage(int32, int32);
-
-extern void sub__consoletitle(qbs *);
-extern void sub__screenshow();
-extern void sub__screenhide();
-extern int32 func__screenhide();
-extern int32 func_windowexists();
-extern int32 func_screenicon();
-extern int32_t func__desktopwidth();
-extern int32_t func__desktopheight();
-extern void sub_screenicon();
-extern void sub__console(int32);
-extern int32 func__console();
-extern void sub__controlchr(int32);
-extern int32 func__controlchr();
-extern void sub__blink(int32);
-extern int32 func__blink();
-extern int32 func__hasfocus();
-extern void set_foreground_window(ptrszint i);
-extern qbs *func__title();
-extern uintptr_t func__windowhandle();
-extern int32 func_stick(int32 i, int32 axis_group, int32 passed);
-extern int32 func_strig(int32 i, int32 controller, int32 passed);
-extern void sub_paletteusing(void *element, int32 bits);
-extern int64 func_read_int64(uint8 *data, ptrszint *data_offset, ptrszint data_size);
-extern int64 func_read_uint64(uint8 *data, ptrszint *data_offset, ptrszint data_size);
-extern void key_on();
-extern void key_off();
-extern void key_list();
-extern void key_assign(int32 i, qbs *str);
-extern int32 func__screeny();
-extern int32 func__screenx();
-extern void sub__screenmove(int32 x, int32 y, int32 passed);
-extern void sub__mousemove(float x, float y);
-extern qbs *func__os();
-extern qbs *func__compdate();
-extern qbs *func__comptime();
-extern qbs *func__compvers();
-extern void sub__mapunicode(int32 unicode_code, int32 ascii_code);
-extern int32 func__mapunicode(int32 ascii_code);
-extern int32 func__keydown(int32 x);
-extern int32 func__keyhit();
-extern int32 func_lpos(int32);
-extern float func__mousemovementx();
-extern float func__mousemovementy();
-extern void sub__screenprint(qbs *txt);
-extern void sub__screenclick(int32 x, int32 y, int32 button, int32 passed);
-extern int32 func__screenimage(int32 x1, int32 y1, int32 x2, int32 y2, int32 passed);
-extern void sub_lock(int32 i, int64 start, int64 end, int32 passed);
-extern void sub_unlock(int32 i, int64 start, int64 end, int32 passed);
-void chain_restorescreenstate(int32);
-void chain_savescreenstate(int32);
-extern void sub__fullscreen(int32 method, int32 passed);
-extern void sub__allowfullscreen(int32 method, int32 smooth);
-extern int32 func__fullscreen();
-extern int32 func__fullscreensmooth();
-extern int32 func__exit();
-extern void revert_input_check();
-extern int32 func__openhost(qbs *);
-extern int32 func__openconnection(int32);
-extern int32 func__openclient(qbs *);
-extern int32 func__connected(int32);
-extern qbs *func__connectionaddress(int32);
-extern void sub_draw(qbs *);
-extern void qbs_maketmp(qbs *);
-extern void sub_run(qbs *);
-extern void sub_run_init();
-extern void freeallimages();
-extern void call_interrupt(int32, void *, void *);
-extern void call_interruptx(int32, void *, void *);
-extern void restorepalette(img_struct *im);
-extern void pset(int32 x, int32 y, uint32 col);
-extern uint32 newimg();
-extern int32 freeimg(uint32);
-extern void imgrevert(int32);
-extern int32 imgframe(uint8 *o, int32 x, int32 y, int32 bpp);
-extern int32 imgnew(int32 x, int32 y, int32 bpp);
-extern void sub__putimage(double f_dx1, double f_dy1, double f_dx2, double f_dy2, int32 src, int32 dst, double f_sx1, double f_sy1, double f_sx2, double f_sy2,
-                          int32 passed);
-extern int32 selectfont(int32 f, img_struct *im);
-extern uint32 sib();
-extern uint32 sib_mod0();
-extern uint8 *rm8();
-extern uint16 *rm16();
-extern uint32 *rm32();
-extern void cpu_call();
-extern int64 build_int64(uint32 val2, uint32 val1);
-extern uint64 build_uint64(uint32 val2, uint32 val1);
-extern char *human_error(int32 errorcode);
-extern void end();
-extern int32 stop_program_state();
-extern uint8 *mem_static_malloc(uint32 size);
-extern void mem_static_restore(uint8 *restore_point);
-extern uint8 *cmem_dynamic_malloc(uint32 size);
-extern void cmem_dynamic_free(uint8 *block);
-extern void sub_defseg(int32 segment, int32 passed);
-extern int32 func_peek(int32 offset);
-extern void sub_poke(int32 offset, int32 value);
-extern void more_return_points();
-extern qbs *func_varptr_helper(uint8 type, uint16 offset);
-extern qbs *qbs_inkey();
-extern void sub__keyclear(int32 buf, int32 passed);
-extern void lineclip(int32 x1, int32 y1, int32 x2, int32 y2, int32 xmin, int32 ymin, int32 xmax, int32 ymax);
-extern void qbg_palette(uint32 attribute, uint32 col, int32 passed);
-extern void qbg_sub_color(uint32 col1, uint32 col2, uint32 bordercolor, int32 i, int32 passed);
-extern void defaultcolors();
-extern void qbg_screen(int32 mode, int32 color_switch, int32 active_page, int32 visual_page, int32 refresh, int32 passed);
-extern void sub_pcopy(int32 src, int32 dst);
-extern void qbsub_width(int32 option, int32 value1, int32 value2, int32 value3, int32 value4, int32 passed);
-extern void pset(int32 x, int32 y, uint32 col);
-extern void pset_and_clip(int32 x, int32 y, uint32 col);
-extern void qb32_boxfill(float x1f, float y1f, float x2f, float y2f, uint32 col);
-extern void fast_boxfill(int32 x1, int32 y1, int32 x2, int32 y2, uint32 col);
-extern void fast_line(int32 x1, int32 y1, int32 x2, int32 y2, uint32 col);
-extern void qb32_line(float x1f, float y1f, float x2f, float y2f, uint32 col, uint32 style);
-extern void sub_line(float x1, float y1, float x2, float y2, uint32 col, int32 bf, uint32 style, int32 passed);
-extern void sub_paint32(float x, float y, uint32 fillcol, uint32 bordercol, int32 passed);
-extern void sub_paint32x(float x, float y, uint32 fillcol, uint32 bordercol, int32 passed);
-extern void sub_paint(float x, float y, uint32 fillcol, uint32 bordercol, qbs *backgroundstr, int32 passed);
-extern void sub_paint(float x, float y, qbs *fillstr, uint32 bordercol, qbs *backgroundstr, int32 passed);
-extern void sub_circle(double x, double y, double r, uint32 col, double start, double end, double aspect, int32 passed);
-extern uint32 point(int32 x, int32 y);
-extern double func_point(float x, float y, int32 passed);
-extern void sub_pset(float x, float y, uint32 col, int32 passed);
-extern void sub_preset(float x, float y, uint32 col, int32 passed);
-extern void printchr(int32 character);
-extern int32_t chrwidth(uint32_t character);
-extern void newline();
-extern void lprint_makefit(qbs *text);
-extern void tab();
-extern void qbs_lprint(qbs *str, int32 finish_on_new_line);
-extern void qbg_sub_view(int32 x1, int32 y1, int32 x2, int32 y2, int32 fillcolor, int32 bordercolor, int32 passed);
-extern void qbg_sub_locate(int32 row, int32 column, int32 cursor, int32 start, int32 stop, int32 passed);
-extern int32 hexoct2uint64(qbs *h);
-extern void qbs_input(int32 numvariables, uint8 newline);
-extern void sub_out(int32 port, int32 data);
-extern void sub_randomize(double seed, int32 passed);
-extern float func_rnd(float n, int32 passed);
-// following are declared below to allow for inlining
-// extern double func_abs(double d);
-// extern long double func_abs(long double d);
-// extern float func_abs(float d);
-
-// extern void sub_open(qbs *name,int32 type,int32 access,int32 sharing,int32
-// i,int32 record_length,int32 passed);
-extern void sub_open(qbs *name, int32 type, int32 access, int32 sharing, int32 i, int64 record_length, int32 passed);
-extern void sub_open_gwbasic(qbs *typestr, int32 i, qbs *name, int64 record_length, int32 passed);
-
-extern void sub_close(int32 i2, int32 passed);
-extern int32 file_input_chr(int32 i);
-extern void file_input_nextitem(int32 i, int32 lastc);
-extern void sub_file_print(int32 i, qbs *str, int32 extraspace, int32 tab, int32 newline);
-extern int32 n_roundincrement();
-extern int32 n_float();
-extern int32 n_int64();
-extern int32 n_uint64();
-extern int32 n_inputnumberfromdata(uint8 *data, ptrszint *data_offset, ptrszint data_size);
-extern int32 n_inputnumberfromfile(int32 fileno);
-extern void sub_file_line_input_string(int32 fileno, qbs *deststr);
-extern void sub_file_input_string(int32 fileno, qbs *deststr);
-extern int64 func_file_input_int64(int32 fileno);
-extern uint64 func_file_input_uint64(int32 fileno);
-extern void sub_read_string(uint8 *data, ptrszint *data_offset, ptrszint data_size, qbs *deststr);
-extern long double func_read_float(uint8 *data, ptrszint *data_offset, ptrszint data_size, int32 typ);
-extern long double func_file_input_float(int32 fileno, int32 typ);
-extern void *byte_element(uint64 offset, int32 length);
-extern void *byte_element(uint64 offset, int32 length, byte_element_struct *info);
-extern void sub_get(int32 i, int64 offset, void *element, int32 passed);
-extern void sub_get2(int32 i, int64 offset, qbs *str, int32 passed);
-
-extern void sub_put(int32 i, int64 offset, void *element, int32 passed);
-extern void sub_put2(int32 i, int64 offset, void *element, int32 passed);
-extern void sub_graphics_get(float x1f, float y1f, float x2f, float y2f, void *element, uint32 mask, int32 passed);
-extern void sub_graphics_put(float x1f, float y1f, void *element, int32 option, uint32 mask, int32 passed);
-extern int32 func_csrlin();
-extern void sub_sleep(int32 seconds, int32 passed);
-extern ptrszint func_lbound(ptrszint *array, int32 index, int32 num_indexes);
-extern ptrszint func_ubound(ptrszint *array, int32 index, int32 num_indexes);
-
-extern int32 func_inp(int32 port);
-extern void sub_wait(int32 port, int32 andexpression, int32 xorexpression, int32 passed);
-extern qbs *func_tab(int32 pos);
-extern qbs *func_spc(int32 spaces);
-extern float func_pmap(float val, int32 option);
-extern uint32 func_screen(int32 y, int32 x, int32 returncol, int32 passed);
-extern void sub_bsave(qbs *filename, int32 offset, int32 size);
-extern void sub_bload(qbs *filename, int32 offset, int32 passed);
-
-extern int64 func_lof(int32 i);
-extern int32 func_eof(int32 i);
-extern void sub_seek(int32 i, int64 pos);
-extern int64 func_seek(int32 i);
-extern int64 func_loc(int32 i);
-extern qbs *func_input(int32 n, int32 i, int32 passed);
-extern int32 func__statusCode(int32 handle);
-
-extern int32 func_freefile();
-extern void sub__mousehide();
-extern void sub__mouseshow(qbs *style, int32 passed);
-extern int32 func__mousehidden();
-extern float func__mousex();
-extern float func__mousey();
-extern int32 func__mouseinput();
-extern int32 func__mousebutton(int32 i);
-extern int32 func__mousewheel();
-
-extern void call_absolute(int32 args, uint16 offset);
-extern void sub__blend(int32 i, int32 passed);
-extern void sub__dontblend(int32 i, int32 passed);
-extern void sub__clearcolor(uint32 c, int32 i, int32 passed);
-extern void sub__setalpha(int32 a, uint32 c, uint32 c2, int32 i, int32 passed);
-extern int32 func__width(int32 i, int32 passed);
-extern int32 func__height(int32 i, int32 passed);
-extern int32 func__pixelsize(int32 i, int32 passed);
-extern int32 func__clearcolor(int32 i, int32 passed);
-extern int32 func__blend(int32 i, int32 passed);
-extern uint32 func__defaultcolor(int32 i, int32 passed);
-extern uint32 func__backgroundcolor(int32 i, int32 passed);
-extern uint32 func__palettecolor(int32 n, int32 i, int32 passed);
-extern void sub__palettecolor(int32 n, uint32 c, int32 i, int32 passed);
-extern void sub__copypalette(int32 i, int32 i2, int32 passed);
-extern void sub__printstring(float x, float y, qbs *text, int32 i, int32 passed);
-extern int32_t func__loadfont(const qbs *qbsFileName, int32_t size, const qbs *qbsRequirements, int32_t font_index, int32_t passed);
-extern void sub__font(int32 f, int32 i, int32 passed);
-extern int32 func__fontwidth(int32 f, int32 passed);
-extern int32 func__fontheight(int32 f, int32 passed);
-extern int32 func__font(int32 i, int32 passed);
-extern void sub__freefont(int32 f);
-extern void sub__printmode(int32 mode, int32 i, int32 passed);
-extern int32 func__printmode(int32 i, int32 passed);
-extern uint32 matchcol(int32 r, int32 g, int32 b);
-extern uint32 matchcol(int32 r, int32 g, int32 b, int32 i);
-extern uint32 func__rgb(int32 r, int32 g, int32 b, int32 i, int32 passed);
-extern uint32 func__rgba(int32 r, int32 g, int32 b, int32 a, int32 i, int32 passed);
-extern int32 func__alpha(uint32 col, int32 i, int32 passed);
-extern int32 func__red(uint32 col, int32 i, int32 passed);
-extern int32 func__green(uint32 col, int32 i, int32 passed);
-extern int32 func__blue(uint32 col, int32 i, int32 passed);
-extern void sub_end();
-extern int32 print_using(qbs *f, int32 s2, qbs *dest, qbs *pu_str);
-extern int32 print_using_integer64(qbs *format, int64 value, int32 start, qbs *output);
-extern int32 print_using_uinteger64(qbs *format, uint64 value, int32 start, qbs *output);
-extern int32 print_using_single(qbs *format, float value, int32 start, qbs *output);
-extern int32 print_using_double(qbs *format, double value, int32 start, qbs *output);
-extern int32 print_using_float(qbs *format, long double value, int32 start, qbs *output);
-
 // shared global variables
-extern int32 sleep_break;
-extern int64 exit_code;
-extern int32 lock_mainloop; // 0=unlocked, 1=lock requested, 2=locked
-extern int64 device_event_index;
-extern int32 exit_ok;
 int32 timer_event_occurred = 0; // inc/dec as each GOSUB to QBMAIN ()
                                 // begins/ends
 int32 timer_event_id = 0;
@@ -385,7 +54,7 @@ int32 tab_LPRINT = 0;      // 1=dest is LPRINT image
 uint64 *nothingvalue; // a pointer to 8 empty bytes in dblock
 uint32 bkp_new_error = 0;
 qbs *nothingstring;
-uint32 qbevent = 0;
+std::atomic<uint32_t> qbevent(0);
 uint8 suspend_program = 0;
 uint8 stop_program = 0;
 uint8_t cmem[1114099]; // 16*65535+65535+3 (enough for highest referenceable dword in conv memory)
@@ -427,42 +96,6 @@ qbs *g_swap_str;
 qbs *pass_str;
 ptrszint data_offset = 0;
 
-// inline functions
-inline void swap_8(void *a, void *b) {
-    uint8 x;
-    x = *(uint8 *)a;
-    *(uint8 *)a = *(uint8 *)b;
-    *(uint8 *)b = x;
-}
-
-inline void swap_16(void *a, void *b) {
-    uint16 x;
-    x = *(uint16 *)a;
-    *(uint16 *)a = *(uint16 *)b;
-    *(uint16 *)b = x;
-}
-
-inline void swap_32(void *a, void *b) {
-    uint32 x;
-    x = *(uint32 *)a;
-    *(uint32 *)a = *(uint32 *)b;
-    *(uint32 *)b = x;
-}
-
-inline void swap_64(void *a, void *b) {
-    uint64 x;
-    x = *(uint64 *)a;
-    *(uint64 *)a = *(uint64 *)b;
-    *(uint64 *)b = x;
-}
-
-inline void swap_longdouble(void *a, void *b) {
-    long double x;
-    x = *(long double *)a;
-    *(long double *)a = *(long double *)b;
-    *(long double *)b = x;
-}
-
 void swap_string(qbs *a, qbs *b) {
     static qbs *c;
     c = qbs_new(a->len, 0);
@@ -496,8 +129,6 @@ void swap_block(void *a, void *b, uint32 bytes) {
     }
 }
 
-extern int32 disableEvents;
-
 ptrszint check_lbound(ptrszint *array, int32 index, int32 num_indexes) {
     static ptrszint ret;
     disableEvents = 1;
@@ -536,31 +167,6 @@ int32 logical_drives() {
 #endif
 }
 
-inline ptrszint array_check(uptrszint index, uptrszint limit) {
-    // nb. forces signed index into an unsigned variable for quicker comparison
-    if (index < limit)
-        return index;
-    error(9);
-    return 0;
-}
-
-inline uint16 varptr_dblock_check(uint8 *off) {
-    // note: 66816 is the top of DBLOCK (SEG:80+OFF:65536)
-    if (off < (&cmem[66816])) { // in DBLOCK?
-        return ((uint16)(off - &cmem[1280]));
-    } else {
-        return ((uint32)(off - cmem)) & 15;
-    }
-}
-
-inline uint16 varseg_dblock_check(uint8 *off) {
-    // note: 66816 is the top of DBLOCK (SEG:80+OFF:65536)
-    if (off < (&cmem[66816])) { // in DBLOCK?
-        return 80;
-    } else {
-        return ((uint32)(off - cmem)) / 16;
-    }
-}
 
 #include "../temp/global.txt"
 #include "../temp/regsf.txt"
@@ -602,12 +208,6 @@ int32 run_from_line = 0;
 // run_from_line's value is an index in a list of possible "run from" locations
 // when 0, the program runs from the beginning
 
-void sub__icon(int32 i, int32 i2, int32 passed);
-
-void sub__display();
-void sub__autodisplay();
-int32 func__autodisplay();
-
 void chain_input() {
     // note: common data or not, every program must check for chained data,
     //      it could be sharing files or screen state
@@ -1352,35 +952,79 @@ uint32 ontimer_freelist_available = 0; // element (if any) which is available)
 ontimer_struct *ontimer = (ontimer_struct *)malloc(sizeof(ontimer_struct));
 // note: index 0 of the above cannot be allocated/freed
 
-int32 ontimerthread_lock = 0;
+// Timers waiting to trigger are kept in a min-heap ordered by deadline, and
+// TIMERTHREAD() sleeps until the earliest one is due or the queue changes.
+// ontimer_mutex protects ontimer[] and the queue.
+struct ontimer_entry {
+    double deadline;
+    int32 i;
+    uint32 schedule; // entry is stale if this no longer matches ontimer[i].schedule
+
+    bool operator>(const ontimer_entry &other) const {
+        return deadline > other.deadline;
+    }
+};
+
+static std::vector<ontimer_entry> ontimer_queue;
+static libqb_mutex *ontimer_mutex = libqb_mutex_new();
+static libqb_condvar *ontimer_wakeup = libqb_condvar_new();
+
+// How late timers trigger compared to their deadline, logged when the program ends
+static uint64_t ontimer_late_count = 0;
+static double ontimer_late_total = 0, ontimer_late_max = 0;
+
+static double ontimer_clock() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 
-void stop_timers() {
-    ontimerthread_lock = 1;
-    while (ontimerthread_lock != 2)
-        ;
+static void ontimer_queue_pop() {
+    std::pop_heap(ontimer_queue.begin(), ontimer_queue.end(), std::greater<ontimer_entry>());
+    ontimer_queue.pop_back();
 }
 
-void start_timers() {
-    ontimerthread_lock = 0;
+// Queues timer i if it is waiting to trigger, and drops any entry queued for it before.
+// ontimer_mutex must be held
+static void ontimer_schedule(int32 i) {
+    ontimer[i].schedule++;
+    if (!ontimer[i].allocated || !ontimer[i].id || !ontimer[i].active || ontimer[i].state)
+        return;
+
+    if (!ontimer[i].last_time)
+        ontimer[i].last_time = ontimer_clock();
+
+    // stale entries normally leave the queue when their deadline passes, but
+    // toggling long timers ON and OFF in a loop would let them pile up
+    if (ontimer_queue.size() > (size_t)ontimer_nextfree * 2 + 64) {
+        std::erase_if(ontimer_queue, [](const ontimer_entry &e) { return e.schedule != ontimer[e.i].schedule; });
+        std::make_heap(ontimer_queue.begin(), ontimer_queue.end(), std::greater<ontimer_entry>());
+    }
+
+    ontimer_queue.push_back({ontimer[i].last_time + ontimer[i].seconds, i, ontimer[i].schedule});
+    std::push_heap(ontimer_queue.begin(), ontimer_queue.end(), std::greater<ontimer_entry>());
+    libqb_condvar_signal(ontimer_wakeup);
+}
+
+// Wakes TIMERTHREAD() so that it sees stop_program
+void wake_timer_thread() {
+    libqb_mutex_guard guard(ontimer_mutex);
+    libqb_condvar_signal(ontimer_wakeup);
 }
 
 int32 func__freetimer() {
     if (is_error_pending())
         return 0;
     static int32 i;
+    libqb_mutex_guard guard(ontimer_mutex);
     if (ontimer_freelist_available) {
         i = ontimer_freelist[ontimer_freelist_available--];
     } else {
-        ontimerthread_lock = 1;
-        while (ontimerthread_lock == 1)
-            Sleep(0); // mutex
         ontimer = (ontimer_struct *)realloc(ontimer, sizeof(ontimer_struct) * (ontimer_nextfree + 1));
         if (!ontimer)
-            error(257);         // out of memory
-        ontimerthread_lock = 0; // mutex
+            error(257); // out of memory
         i = ontimer_nextfree;
         ontimer[i].state = 0; // state is not set to 0 if reusing an existing
                               // index as event could still be in progress
+        ontimer[i].schedule = 0;
     }
     ontimer[i].active = 0;
     ontimer[i].id = 0;
@@ -1393,6 +1037,7 @@ int32 func__freetimer() {
 void freetimer(int32 i) {
     ontimer[i].allocated = 0;
     ontimer[i].id = 0;
+    ontimer_schedule(i); // drops its queue entry
     if (ontimer_freelist_available == ontimer_freelist_size) {
         ontimer_freelist_size *= 2;
         ontimer_freelist = (int32 *)realloc(ontimer_freelist, ontimer_freelist_size * 4);
@@ -1412,13 +1057,14 @@ void ontimer_setup(int32 i, double sec, uint32 id, int64 pass) {
         error(5);
         return;
     }
+    libqb_mutex_guard guard(ontimer_mutex);
     if (ontimer[i].state == 1)
         ontimer[i].state = 0; // retract prev event if not in progress
     ontimer[i].seconds = sec;
     ontimer[i].pass = pass;
     ontimer[i].last_time = 0;
-    ontimer[i].id = id; // id must be set last because it is the trigger
-                        // variable
+    ontimer[i].id = id;
+    ontimer_schedule(i);
 }
 
 void sub_timer(int32 i, int32 option, int32 passed) {
@@ -1437,21 +1083,27 @@ void sub_timer(int32 i, int32 option, int32 passed) {
     }
     // ref: uint8 active;//0=OFF, 1=ON, 2=STOP
     if (option == 1) { // ON
+        libqb_mutex_guard guard(ontimer_mutex);
         ontimer[i].active = 1;
+        ontimer_schedule(i);
 
         // This is necessary so that if a timer triggered while stopped we will run it now.
         qbevent = 1;
         return;
     }
     if (option == 2) { // OFF
+        libqb_mutex_guard guard(ontimer_mutex);
         ontimer[i].active = 0;
         if (ontimer[i].state == 1)
             ontimer[i].state = 0; // retract event if not in progress
         ontimer[i].last_time = 0; // when ON is next used, the timer will start over
+        ontimer_schedule(i);
         return;
     }
     if (option == 3) { // STOP
+        libqb_mutex_guard guard(ontimer_mutex);
         ontimer[i].active = 2;
+        ontimer_schedule(i);
         return;
     }
     if (option == 4) { // FREE
@@ -1459,6 +1111,7 @@ void sub_timer(int32 i, int32 option, int32 passed) {
             error(5);
             return;
         }
+        libqb_mutex_guard guard(ontimer_mutex);
         ontimer[i].active = 0;
         if (ontimer[i].state == 1)
             ontimer[i].state = 0; // retract event if not in progress
@@ -1472,43 +1125,54 @@ void sub_timer(int32 i, int32 option, int32 passed) {
 }
 
 void TIMERTHREAD(void *unused) {
-    static int32 i;
-    static double time_now = 100000;
-    while (1) {
-    quick_lock:
-        if (ontimerthread_lock == 1)
-            ontimerthread_lock = 2; // mutex, verify lock
-        if (!ontimerthread_lock) {  // mutex
-            time_now = ((double)GetTicks()) * 0.001;
-            for (i = 0; i < ontimer_nextfree; i++) {
-                if (ontimer[i].allocated && ontimer[i].id && ontimer[i].active && !ontimer[i].state) {
-                    if (!ontimer[i].last_time) {
-                        ontimer[i].last_time = time_now;
-                    } else if (time_now - ontimer[i].last_time > ontimer[i].seconds) {
-                        // keep measured time for accurate
-                        // number of calls overall
-                        ontimer[i].last_time += ontimer[i].seconds;
-
-                        // if difference between actual time and
-                        // measured time is beyond 'seconds' set
-                        // measured to actual
-                        if (std::fabs(time_now - ontimer[i].last_time) >= ontimer[i].seconds)
-                            ontimer[i].last_time = time_now;
-                        ontimer[i].state = 1;
-                        qbevent = 1;
-                    } // time check
-                }
-                if (ontimerthread_lock == 1)
-                    goto quick_lock;
-            } // i
-        } // not locked
-        Sleep(1);
-        if (stop_program) {
-            exit_ok |= 2;
-            return;
-        } // close thread #2
-    } // while(1)
-    return;
+    {
+        libqb_mutex_guard guard(ontimer_mutex);
+
+        while (!stop_program) {
+            if (ontimer_queue.empty()) {
+                libqb_condvar_wait(ontimer_wakeup, ontimer_mutex);
+                continue;
+            }
+
+            ontimer_entry next = ontimer_queue.front();
+            if (next.schedule != ontimer[next.i].schedule) {
+                ontimer_queue_pop(); // retracted or rescheduled since it was queued
+                continue;
+            }
+
+            double time_now = ontimer_clock();
+            if (time_now < next.deadline) {
+                libqb_condvar_wait_for(ontimer_wakeup, ontimer_mutex, (uint64_t)std::ceil((next.deadline - time_now) * 1000000.0));
+                continue;
+            }
+
+            ontimer_queue_pop();
+
+            double late = time_now - next.deadline;
+            ontimer_late_count++;
+            ontimer_late_total += late;
+            if (late > ontimer_late_max)
+                ontimer_late_max = late;
+
+            // keep measured time for accurate
+            // number of calls overall
+            ontimer[next.i].last_time += ontimer[next.i].seconds;
+
+            // if difference between actual time and
+            // measured time is beyond 'seconds' set
+            // measured to actual
+            if (std::fabs(time_now - ontimer[next.i].last_time) >= ontimer[next.i].seconds)
+                ontimer[next.i].last_time = time_now;
+            ontimer[next.i].state = 1; // queued again once the event has run
+            qbevent = 1;
+        }
+
+        if (ontimer_late_count)
+            libqb_log_info("ON TIMER: %llu events, triggered %.3f ms late on average, %.3f ms at worst", (unsigned long long)ontimer_late_count,
+                           ontimer_late_total / ontimer_late_count * 1000.0, ontimer_late_max * 1000.0);
+    }
+
+    exit_ok |= 2; // close thread #2
 }
 
 void events() {
@@ -1586,28 +1250,35 @@ onkey_recheck:
     // ontimer events
     if (!error_handling) { // no new on timer calls happen whilst error handling
         for (i = 0; i < ontimer_nextfree; i++) {
-            if (ontimer[i].allocated) {
-                if (ontimer[i].id) {
-                    if (ontimer[i].active == 1) { // if timer STOPped, event will be postponed
-                        if (ontimer[i].state == 1) {
-                            ontimer[i].state = 2; // event in progress
-                            x = ontimer[i].id;
-                            i64 = ontimer[i].pass;
-                            switch (x) {
+            x = 0;
+            libqb_mutex_lock(ontimer_mutex);
+            if (ontimer[i].allocated && ontimer[i].id) {
+                if (ontimer[i].active == 1) { // if timer STOPped, event will be postponed
+                    if (ontimer[i].state == 1) {
+                        ontimer[i].state = 2; // event in progress
+                        x = ontimer[i].id;
+                        i64 = ontimer[i].pass;
+                    } // state==1
+                } // active==1
+            } // allocated && id
+            libqb_mutex_unlock(ontimer_mutex);
+
+            if (x) { // the event runs unlocked, it may well use TIMER itself
+                switch (x) {
 #include "../temp/ontimer.txt"
-                            // example.....
-                            // case 1:
-                            //...
-                            // break;
-                            default:
-                                break;
-                            } // switch
-                            ontimer[i].state = 0; // event finished
-                            sleep_break = 1;
-                        } // state==1
-                    } // active==1
-                } // id
-            } // allocated
+                // example.....
+                // case 1:
+                //...
+                // break;
+                default:
+                    break;
+                } // switch
+                libqb_mutex_lock(ontimer_mutex);
+                ontimer[i].state = 0; // event finished
+                ontimer_schedule(i);
+                libqb_mutex_unlock(ontimer_mutex);
+                sleep_break = 1;
+            }
         } // i
     } //! error_handling
 }
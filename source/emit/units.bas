@@ -0,0 +1,140 @@
+'
+' Moves the SUBs and FUNCTIONs of a large program out of qbx.cpp and into a few
+' separately compiled code units (unit1.cpp, unit2.cpp, ...), so make can build
+' them in parallel. Units whose code did not change are not rewritten, so after
+' an edit make only rebuilds the units that actually changed.
+'
+' The units include units.h, which declares the program's globals and everything
+' they use from qbx.cpp, and are listed for the Makefile in units.mk. When the
+' program can't be split (or is too small to be worth it) units.mk is deleted,
+' so units left over from an earlier build never get linked in, and main.txt
+' keeps including every SUB/FUNCTION into qbx.cpp.
+'
+' Has to be called once all the buffers have been written to disk.
+'
+SUB WriteCodeUnits (buildFlags AS STRING)
+    CONST UNIT_SIZE_MIN = 131072, UNIT_SIZE_MAX = 524288
+
+    DIM AS LONG h, i, x, depth, unitCount, totalSize
+    DIM AS STRING nl, a, decl, code, signature, objs, mainInclude, mainTxt
+
+    nl = CHR$(10)
+
+    ' OpenGL, DECLARE LIBRARY and the $DEBUG hooks all expect to see the whole
+    ' program in one translation unit
+    IF subfuncnlast = 0 OR ResolveStaticFunctions > 0 OR DEPENDENCY(DEPENDENCY_GL) OR GetRCStateVar(vWatchOn) THEN GOTO writeUnitList
+
+    FOR i = 1 TO subfuncnlast
+        h = OpenBuffer%("I", tmpdir$ + "main" + _TOSTR$(i) + ".txt")
+        totalSize = totalSize + GetBufLen&(h)
+    NEXT
+    IF totalSize < UNIT_SIZE_MIN * 2 THEN GOTO writeUnitList
+
+    ' The globals stay defined in qbx.cpp, the units just get declarations
+    h = OpenBuffer%("I", tmpdir$ + "global.txt")
+    DO UNTIL EndOfBuf%(h)
+        a = ReadBufLine$(h)
+        IF LEFT$(a, 9) = "template " OR LEFT$(a, 7) = "static " THEN
+            'internal helpers, every unit gets its own copy
+            decl = decl + a + nl
+            depth = BraceDepthChange&(a)
+            DO WHILE depth > 0 AND NOT EndOfBuf%(h)
+                a = ReadBufLine$(h)
+                decl = decl + a + nl
+                depth = depth + BraceDepthChange&(a)
+            LOOP
+        ELSEIF LEN(a) THEN
+            'anything not understood keeps the program in one piece
+            x = INSTR(a, "=")
+            IF x = 0 THEN GOTO writeUnitList
+            IF INSTR(LEFT$(a, x), "(") THEN GOTO writeUnitList
+
+            decl = decl + "extern " + LEFT$(a, x - 1) + ";" + nl
+
+            IF RIGHT$(a, 1) = "{" THEN 'skip an array initializer
+                DO UNTIL RIGHT$(a, 2) = "};" OR EndOfBuf%(h)
+                    a = ReadBufLine$(h)
+                LOOP
+            END IF
+        END IF
+    LOOP
+
+    ' Only plain SUB/FUNCTION prototypes can be shared, DECLARE LIBRARY adds
+    ' headers, typedefs and function pointers which define things
+    h = OpenBuffer%("I", tmpdir$ + "regsf.txt")
+    DO UNTIL EndOfBuf%(h)
+        a = ReadBufLine$(h)
+        IF LEN(a) THEN
+            IF RIGHT$(a, 2) <> ");" OR LEFT$(a, 1) = "#" OR LEFT$(a, 8) = "typedef " OR INSTR(a, "=") > 0 THEN GOTO writeUnitList
+            decl = decl + a + nl
+        END IF
+    LOOP
+
+    ' The version and build flags are part of the header so that changing them
+    ' rebuilds every unit
+    WriteFileIfChanged tmpdir$ + "units.h", "// QB64-PE v" + Version$ + ":" + buildFlags + nl + "#include " + AddQuotes$("../c/qbx.h") + nl + decl
+
+    ' A unit ends after a SUB/FUNCTION picked by its declaration rather than by
+    ' position alone, so an edit rarely moves code from one unit into another
+    FOR i = 1 TO subfuncnlast
+        h = OpenBuffer%("I", tmpdir$ + "main" + _TOSTR$(i) + ".txt")
+        signature = ReadBufLine$(h)
+        x = SeekBuf&(h, 0, SBM_BufStart)
+        a = ReadBufRawData$(h, GetBufLen&(h))
+
+        a = ExpandGeneratedInclude$(a, "data" + _TOSTR$(i) + ".txt")
+        a = ExpandGeneratedInclude$(a, "ret" + _TOSTR$(i) + ".txt")
+        a = ExpandGeneratedInclude$(a, "free" + _TOSTR$(i) + ".txt")
+        code = code + a
+
+        IF i = subfuncnlast OR LEN(code) >= UNIT_SIZE_MAX OR (LEN(code) >= UNIT_SIZE_MIN AND (_CRC32(signature) AND 3) = 0) THEN
+            unitCount = unitCount + 1
+            WriteFileIfChanged tmpdir$ + "unit" + _TOSTR$(unitCount) + ".cpp", "#include " + AddQuotes$("units.h") + nl + code
+            objs = objs + " $(PATH_INTERNAL_TEMP)/unit" + _TOSTR$(unitCount) + ".o"
+            code = ""
+        END IF
+    NEXT
+
+    ' qbx.cpp keeps the main module only
+    mainInclude = "#include " + CHR$(34) + "main"
+    h = OpenBuffer%("I", tmpdir$ + "main.txt")
+    DO UNTIL EndOfBuf%(h)
+        a = ReadBufLine$(h)
+        IF LEFT$(a, LEN(mainInclude)) <> mainInclude OR a = mainInclude + "0.txt" + CHR$(34) THEN mainTxt = mainTxt + a + nl
+    LOOP
+    h = OpenBuffer%("O", tmpdir$ + "main.txt")
+    WriteBufRawData h, mainTxt
+    WriteBuffers tmpdir$ + "main.txt"
+
+    writeUnitList:
+    IF LEN(objs) THEN
+        WriteFileIfChanged tmpdir$ + "units.mk", "# Generated by QB64-PE, see source/emit/units.bas" + nl + "QB_UNIT_OBJS :=" + objs + nl
+    ELSEIF _FILEEXISTS(tmpdir$ + "units.mk") THEN
+        KILL tmpdir$ + "units.mk"
+    END IF
+END SUB
+
+' Replaces the #include of a generated file with the file's content
+FUNCTION ExpandGeneratedInclude$ (code AS STRING, fileName AS STRING)
+    DIM h AS LONG, inc AS STRING
+
+    inc = "#include " + AddQuotes$(fileName)
+    IF INSTR(code, inc) THEN
+        h = OpenBuffer%("I", tmpdir$ + fileName)
+        ExpandGeneratedInclude$ = StrReplace$(code, inc, ReadBufRawData$(h, GetBufLen&(h)))
+    ELSE
+        ExpandGeneratedInclude$ = code
+    END IF
+END FUNCTION
+
+FUNCTION BraceDepthChange& (s AS STRING)
+    DIM AS LONG i, n
+
+    FOR i = 1 TO LEN(s)
+        SELECT CASE ASC(s, i)
+            CASE 123: n = n + 1 '{
+            CASE 125: n = n - 1 '}
+        END SELECT
+    NEXT
+    BraceDepthChange& = n
+END FUNCTION
@@ -516,7 +516,7 @@ FUNCTION ide2 (ignore)
         idepath$ = _STARTDIR$
 
         'new blank text field
-        idet$ = MKL$(0) + MKL$(0): idel = 1: ideli = 1: iden = 1: IdeBmkN = 0
+        idetextclear: IdeBmkN = 0
         REDIM IdeBreakpoints(iden) AS _BYTE
         REDIM IdeSkipLines(iden) AS _BYTE
         variableWatchList$ = ""
@@ -559,13 +559,13 @@ FUNCTION ide2 (ignore)
                     GET #150, , ideselect: GET #150, , ideselectx1: GET #150, , ideselecty1
                     GET #150, , iden
                     GET #150, , idel
-                    GET #150, , ideli
+                    GET #150, , x& 'line offset, unused
                     'bookmark info [v2]
                     GET #150, , IdeBmkN: REDIM IdeBmk(IdeBmkN + 1) AS IdeBmkType
                     FOR bi = 1 TO IdeBmkN: GET #150, , IdeBmk(bi).y: GET #150, , IdeBmk(bi).x: NEXT
                     'text info compressed instead plain [v3]
                     GET #150, , x&: GET #150, , ox&: ideundotxt$ = SPACE$(x&): GET #150, , ideundotxt$
-                    idet$ = _INFLATE$(ideundotxt$, ox&)
+                    idetextimport _INFLATE$(ideundotxt$, ox&)
                 END IF
                 CLOSE #150
             END IF
@@ -586,8 +586,7 @@ FUNCTION ide2 (ignore)
                 ideerror = 3
                 idepath$ = path$
                 lineinput3load path$ + idepathsep$ + f$
-                idet$ = SPACE$(LEN(lineinput3buffer) * 8)
-                i2 = 1
+                idetextnew LEN(lineinput3buffer) \ 32
                 n = 0
                 chrtab$ = CHR$(9)
                 space1$ = " ": space2$ = "  ": space3$ = "   ": space4$ = "    "
@@ -609,11 +608,11 @@ FUNCTION ide2 (ignore)
                                 IF x2 = 3 THEN a$ = LEFT$(a$, x - 1) + space1$ + RIGHT$(a$, l - x): GOTO ideopenfixtabsx
                             END IF
                         END IF 'asca<>-1
-                        MID$(idet$, i2, l + 8) = MKL$(l) + a$ + MKL$(l): i2 = i2 + l + 8: n = n + 1
+                        idetextappend a$: n = n + 1
                     END IF
                 LOOP UNTIL asca = 13
                 lineinput3buffer = ""
-                iden = n: IF n = 0 THEN idet$ = MKL$(0) + MKL$(0): iden = 1 ELSE idet$ = LEFT$(idet$, i2 - 1)
+                IF n = 0 THEN idetextappend ""
                 REDIM IdeBreakpoints(iden) AS _BYTE
                 REDIM IdeSkipLines(iden) AS _BYTE
                 variableWatchList$ = ""
@@ -1261,13 +1260,15 @@ FUNCTION ide2 (ignore)
                 a$ = a$ + MKL$(ideselect) + MKL$(ideselectx1) + MKL$(ideselecty1) 'selection state & position
                 a$ = a$ + MKL$(iden) 'number of lines
                 a$ = a$ + MKL$(idel) 'selected line in buffer
-                a$ = a$ + MKL$(ideli) 'selected line offset in buffer
+                a$ = a$ + MKL$(0) 'selected line offset in buffer (no longer used)
                 'bookmark info [v2]
                 a$ = a$ + MKL$(IdeBmkN)
                 FOR bi = 1 TO IdeBmkN: a$ = a$ + MKL$(IdeBmk(bi).y) + MKL$(IdeBmk(bi).x): NEXT
                 'text info compressed instead plain [v3]
-                ideundotxt$ = _DEFLATE$(idet$): l& = LEN(ideundotxt$) 'compress edited text
-                a$ = a$ + MKL$(l&) + MKL$(LEN(idet$)) 'compressed data size + original text size
+                undotext$ = idetextexport$
+                ideundotxt$ = _DEFLATE$(undotext$): l& = LEN(ideundotxt$) 'compress edited text
+                a$ = a$ + MKL$(l&) + MKL$(LEN(undotext$)) 'compressed data size + original text size
+                undotext$ = _STR_EMPTY
                 a$ = MKL$(l& + LEN(a$)) + a$ + ideundotxt$ + MKL$(l& + LEN(a$)) 'header, data & encapsulation (reverse navigatable list)
 
                 'add undo event
@@ -3622,13 +3623,13 @@ FUNCTION ide2 (ignore)
                     GET #150, , ideselect: GET #150, , ideselectx1: GET #150, , ideselecty1
                     GET #150, , iden
                     GET #150, , idel
-                    GET #150, , ideli
+                    GET #150, , x& 'line offset, unused
                     'bookmark info [v2]
                     GET #150, , IdeBmkN: REDIM IdeBmk(IdeBmkN + 1) AS IdeBmkType
                     FOR bi = 1 TO IdeBmkN: GET #150, , IdeBmk(bi).y: GET #150, , IdeBmk(bi).x: NEXT
                     'text info compressed instead plain [v3]
                     GET #150, , x&: GET #150, , ox&: ideundotxt$ = SPACE$(x&): GET #150, , ideundotxt$
-                    idet$ = _INFLATE$(ideundotxt$, ox&)
+                    idetextimport _INFLATE$(ideundotxt$, ox&)
 
                     idechangemade = 1: idenoundo = 1: startPausedPending = 0
 
@@ -3685,13 +3686,13 @@ FUNCTION ide2 (ignore)
                     GET #150, , ideselect: GET #150, , ideselectx1: GET #150, , ideselecty1
                     GET #150, , iden
                     GET #150, , idel
-                    GET #150, , ideli
+                    GET #150, , x& 'line offset, unused
                     'bookmark info [v2]
                     GET #150, , IdeBmkN: REDIM IdeBmk(IdeBmkN + 1) AS IdeBmkType
                     FOR bi = 1 TO IdeBmkN: GET #150, , IdeBmk(bi).y: GET #150, , IdeBmk(bi).x: NEXT
                     'text info compressed instead plain [v3]
                     GET #150, , x&: GET #150, , ox&: ideundotxt$ = SPACE$(x&): GET #150, , ideundotxt$
-                    idet$ = _INFLATE$(ideundotxt$, ox&)
+                    idetextimport _INFLATE$(ideundotxt$, ox&)
 
                     idechangemade = 1: idenoundo = 1: startPausedPending = 0
 
@@ -6561,7 +6562,7 @@ FUNCTION ide2 (ignore)
                 backupTypeDefinitions$ = ""
                 watchpointList$ = ""
                 callstacklist$ = "": callStackLength = 0
-                idet$ = MKL$(0) + MKL$(0): idel = 1: ideli = 1: iden = 1: IdeBmkN = 0
+                idetextclear: IdeBmkN = 0
                 idesx = 1
                 idesy = 1
                 idecx = 1
@@ -11425,9 +11426,8 @@ SUB idedelline (i)
     END IF
 
     idegotoline i
-    textlen = CVL(MID$(idet$, ideli, 4))
-    idet$ = LEFT$(idet$, ideli - 1) + RIGHT$(idet$, LEN(idet$) - ideli + 1 - 8 - textlen)
-    iden = iden - 1
+    idetextdelete i
+    IF iden = 0 THEN idetextappend "" 'there is always at least one line
 
     IF i > iden THEN idegotoline iden '[2013] if last line was removed, move to previous line
 
@@ -12116,7 +12116,7 @@ END SUB
 
 FUNCTION idegetline$ (i)
     IF i <> -1 THEN idegotoline i
-    idegetline$ = MID$(idet$, ideli + 4, CVL(MID$(idet$, ideli, 4)))
+    idegetline$ = IdeLineText(idetextslot(idel))
 END FUNCTION
 
 SUB idecentercurrentline
@@ -12128,20 +12128,8 @@ END SUB
 SUB idegotoline (i)
     IF idel = i THEN EXIT SUB
     IF i < 1 THEN i = 1
-    'scan backwards
-    IF i < idel THEN
-        DO
-            idel = idel - 1
-            ideli = ideli - CVL(MID$(idet$, ideli - 4, 4)) - 8
-        LOOP UNTIL idel = i
-        EXIT SUB
-    END IF
-    'assume scan forwards
-    DO
-        IF idel = iden THEN idet$ = idet$ + MKL$(0) + MKL$(0): iden = iden + 1 'insert blank line at end?
-        idel = idel + 1
-        ideli = ideli + CVL(MID$(idet$, ideli, 4)) + 8
-    LOOP UNTIL idel = i
+    DO WHILE i > iden: idetextappend "": LOOP 'insert blank lines at end?
+    idel = i
 END SUB
 
 FUNCTION idehbar (x, y, h, i2, n2)
@@ -12283,9 +12271,7 @@ SUB ideinsline (i, text$)
     END IF
     idegotoline i
     'insert line
-    textlen = LEN(text$)
-    idet$ = LEFT$(idet$, ideli - 1) + (MKL$(textlen) + text$ + MKL$(textlen)) + RIGHT$(idet$, LEN(idet$) - ideli + 1)
-    iden = iden + 1
+    idetextinsert i, text$
 END SUB
 
 FUNCTION ideinputbox$ (title$, caption$, initialvalue$, validinput$, boxwidth, maxlength, ok)
@@ -12850,7 +12836,7 @@ FUNCTION idefiledialog$ (programname$, mode AS _BYTE)
 
                 'load file
                 ideerror = 3
-                idet$ = MKL$(0) + MKL$(0): idel = 1: ideli = 1: iden = 1: IdeBmkN = 0
+                idetextclear: IdeBmkN = 0
                 idesx = 1
                 idesy = 1
                 idecx = 1
@@ -12858,8 +12844,7 @@ FUNCTION idefiledialog$ (programname$, mode AS _BYTE)
                 ideselect = 0
                 idefocusline = 0
                 lineinput3load path$ + idepathsep$ + f$
-                idet$ = SPACE$(LEN(lineinput3buffer) * 8)
-                i2 = 1
+                idetextnew LEN(lineinput3buffer) \ 32
                 n = 0
                 chrtab$ = CHR$(9)
                 space1$ = " ": space2$ = "  ": space3$ = "   ": space4$ = "    "
@@ -12881,11 +12866,11 @@ FUNCTION idefiledialog$ (programname$, mode AS _BYTE)
                                 IF x2 = 3 THEN a$ = LEFT$(a$, x - 1) + space1$ + RIGHT$(a$, l - x): GOTO ideopenfixtabs
                             END IF
                         END IF 'asca<>-1
-                        MID$(idet$, i2, l + 8) = MKL$(l) + a$ + MKL$(l): i2 = i2 + l + 8: n = n + 1
+                        idetextappend a$: n = n + 1
                     END IF
                 LOOP UNTIL asca = 13
                 lineinput3buffer = ""
-                iden = n: IF n = 0 THEN idet$ = MKL$(0) + MKL$(0): iden = 1 ELSE idet$ = LEFT$(idet$, i2 - 1)
+                IF n = 0 THEN idetextappend ""
                 REDIM IdeBreakpoints(iden) AS _BYTE
                 REDIM IdeSkipLines(iden) AS _BYTE
                 variableWatchList$ = ""
@@ -12988,8 +12973,7 @@ SUB idesetline (i, text$)
     text$ = RTRIM$(text$)
 
     IF i <> -1 THEN idegotoline i
-    textlen = LEN(text$)
-    idet$ = LEFT$(idet$, ideli - 1) + (MKL$(textlen) + text$ + MKL$(textlen)) + RIGHT$(idet$, LEN(idet$) - ideli + 1 - CVL(MID$(idet$, ideli, 4)) - 8)
+    IdeLineText(idetextslot(idel)) = text$
 
 END SUB
 
@@ -16787,6 +16771,7 @@ FUNCTION ideLoggingBox
             temp$ = _STR_EMPTY
             temp$ = temp$ + _IIF(o(conChk).sel <> 0, ",console,", "")
             temp$ = temp$ + _IIF(o(filChk).sel <> 0, ",file,", "")
+            IF LEN(temp$) > 0 AND INSTR("," + LogHandlers$ + ",", ",async,") > 0 THEN temp$ = temp$ + ",async," 'keep the hand set writer mode
             temp$ = StrReplace$(temp$, ",,", ",")
             v% = LEN(temp$): temp$ = MID$(temp$, 2, v% - 2)
             IF LogHandlers$ <> temp$ THEN LogHandlers$ = temp$: optChg% = _TRUE
@@ -21359,7 +21344,7 @@ FUNCTION OpenFile$ (IdeOpenFile AS STRING) 'load routine copied/pasted from the
 
     'load file
     ideerror = 3
-    idet$ = MKL$(0) + MKL$(0): idel = 1: ideli = 1: iden = 1: IdeBmkN = 0
+    idetextclear: IdeBmkN = 0
     idesx = 1
     idesy = 1
     idecx = 1
@@ -21367,8 +21352,7 @@ FUNCTION OpenFile$ (IdeOpenFile AS STRING) 'load routine copied/pasted from the
     ideselect = 0
     idefocusline = 0
     lineinput3load path$ + idepathsep$ + f$
-    idet$ = SPACE$(LEN(lineinput3buffer) * 8)
-    i2 = 1
+    idetextnew LEN(lineinput3buffer) \ 32
     n = 0
     chrtab$ = CHR$(9)
     space1$ = " ": space2$ = "  ": space3$ = "   ": space4$ = "    "
@@ -21390,11 +21374,11 @@ FUNCTION OpenFile$ (IdeOpenFile AS STRING) 'load routine copied/pasted from the
                     IF x2 = 3 THEN a$ = LEFT$(a$, x - 1) + space1$ + RIGHT$(a$, l - x): GOTO ideopenfixtabs
                 END IF
             END IF 'asca<>-1
-            MID$(idet$, i2, l + 8) = MKL$(l) + a$ + MKL$(l): i2 = i2 + l + 8: n = n + 1
+            idetextappend a$: n = n + 1
         END IF
     LOOP UNTIL asca = 13
     lineinput3buffer = ""
-    iden = n: IF n = 0 THEN idet$ = MKL$(0) + MKL$(0): iden = 1 ELSE idet$ = LEFT$(idet$, i2 - 1)
+    IF n = 0 THEN idetextappend ""
     REDIM IdeBreakpoints(iden) AS _BYTE
     REDIM IdeSkipLines(iden) AS _BYTE
     variableWatchList$ = ""
@@ -21413,4 +21397,5 @@ END FUNCTION
 '$INCLUDE:'wiki\wiki_methods.bas'
 '$INCLUDE:'ide_converters.bas'
 '$INCLUDE:'ide_export.bas'
+'$INCLUDE:'text\text_methods.bas'
 
@@ -0,0 +1,10 @@
+'Program text
+'Each line is stored once in IdeLineText() and stays in its slot until deleted. IdeLineSlot()
+'lists the slots in line order as a gap buffer: entries 1 to IdeLineGap - 1 hold lines 1 onwards,
+'entries IdeLineGapEnd to UBOUND hold the remaining lines, and the gap in between moves to wherever
+'lines are inserted or deleted. Any line can be found directly and editing only moves the LONGs
+'between the last edit and this one, never the text itself.
+
+DIM SHARED idel, iden 'current line, number of lines
+REDIM SHARED IdeLineText(1) AS STRING, IdeLineSlot(1) AS LONG, IdeLineFree(1) AS LONG
+DIM SHARED IdeLineGap, IdeLineGapEnd, IdeLineTextN, IdeLineFreeN
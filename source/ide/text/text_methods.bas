@@ -0,0 +1,106 @@
+SUB idetextnew (lines)
+    'empty buffer with room for a number of lines
+    n = lines: IF n < 16 THEN n = 16
+    REDIM IdeLineText(n) AS STRING
+    REDIM IdeLineSlot(n) AS LONG
+    REDIM IdeLineFree(16) AS LONG
+    IdeLineGap = 1: IdeLineGapEnd = n + 1
+    IdeLineTextN = 0: IdeLineFreeN = 0
+    iden = 0: idel = 1
+END SUB
+
+SUB idetextclear
+    'new blank text field
+    idetextnew 0
+    idetextappend ""
+END SUB
+
+SUB idetextappend (text$)
+    idetextinsert iden + 1, text$
+END SUB
+
+FUNCTION idetextslot (i)
+    'IdeLineText() slot of line i
+    IF i < IdeLineGap THEN idetextslot = IdeLineSlot(i) ELSE idetextslot = IdeLineSlot(i + IdeLineGapEnd - IdeLineGap)
+END FUNCTION
+
+SUB idetextmovegap (i)
+    'moves the gap to just before line i
+    IF i < IdeLineGap THEN
+        FOR s = IdeLineGap - 1 TO i STEP -1
+            IdeLineGapEnd = IdeLineGapEnd - 1
+            IdeLineSlot(IdeLineGapEnd) = IdeLineSlot(s)
+        NEXT
+    ELSE
+        FOR s = IdeLineGap TO i - 1
+            IdeLineSlot(s) = IdeLineSlot(IdeLineGapEnd)
+            IdeLineGapEnd = IdeLineGapEnd + 1
+        NEXT
+    END IF
+    IdeLineGap = i
+END SUB
+
+SUB idetextinsert (i, text$)
+    'inserts a new line i (1 to iden + 1)
+    IF IdeLineGap = IdeLineGapEnd THEN
+        'gap is used up, double the size of the index
+        n = UBOUND(IdeLineSlot)
+        REDIM _PRESERVE IdeLineSlot(n * 2) AS LONG
+        FOR s = n TO IdeLineGapEnd STEP -1
+            IdeLineSlot(s + n) = IdeLineSlot(s)
+        NEXT
+        IdeLineGapEnd = IdeLineGapEnd + n
+    END IF
+    idetextmovegap i
+
+    IF IdeLineFreeN THEN
+        slot = IdeLineFree(IdeLineFreeN): IdeLineFreeN = IdeLineFreeN - 1
+    ELSE
+        IF IdeLineTextN = UBOUND(IdeLineText) THEN REDIM _PRESERVE IdeLineText(IdeLineTextN * 2) AS STRING
+        IdeLineTextN = IdeLineTextN + 1: slot = IdeLineTextN
+    END IF
+    IdeLineText(slot) = text$
+
+    IdeLineSlot(IdeLineGap) = slot
+    IdeLineGap = IdeLineGap + 1
+    iden = iden + 1
+END SUB
+
+SUB idetextdelete (i)
+    'removes line i
+    idetextmovegap i
+    slot = IdeLineSlot(IdeLineGapEnd)
+    IdeLineGapEnd = IdeLineGapEnd + 1
+    iden = iden - 1
+
+    IdeLineText(slot) = _STR_EMPTY
+    IF IdeLineFreeN = UBOUND(IdeLineFree) THEN REDIM _PRESERVE IdeLineFree(IdeLineFreeN * 2) AS LONG
+    IdeLineFreeN = IdeLineFreeN + 1: IdeLineFree(IdeLineFreeN) = slot
+END SUB
+
+SUB idetextimport (t$)
+    'replaces the text with lines stored as MKL$(length) + line + MKL$(length), as kept by undo
+    idetextnew LEN(t$) \ 32
+    p = 1
+    DO WHILE p < LEN(t$)
+        l = CVL(MID$(t$, p, 4))
+        idetextappend MID$(t$, p + 4, l)
+        p = p + l + 8
+    LOOP
+    IF iden = 0 THEN idetextappend ""
+END SUB
+
+FUNCTION idetextexport$
+    'all lines in the format read by idetextimport
+    size = 0
+    FOR i = 1 TO iden
+        size = size + LEN(IdeLineText(idetextslot(i))) + 8
+    NEXT
+    t$ = SPACE$(size)
+    p = 1
+    FOR i = 1 TO iden
+        slot = idetextslot(i): l = LEN(IdeLineText(slot))
+        MID$(t$, p, l + 8) = MKL$(l) + IdeLineText(slot) + MKL$(l): p = p + l + 8
+    NEXT
+    idetextexport$ = t$
+END FUNCTION
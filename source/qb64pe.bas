@@ -13497,16 +13497,17 @@ PRINT #eflFF, "#include <stdint.h>"
 PRINT #eflFF, "#include <string.h>"
 PRINT #eflFF, "#include "; AddQuotes$("../c/libqb.h")
 PRINT #eflFF, "#include "; AddQuotes$("../c/libqb/include/compression.h")
+PRINT #eflFF, "#include "; AddQuotes$("../c/libqb/include/embed.h")
 PRINT #eflFF, ""
 CLOSE #eflFF
-'append files converted into arrays
+'append the embedded files
 '> embed only those $EMBED files, which are referenced by at least
 '  one _EMBEDDED$() call to avoid unnecessary bloat
 '> adjust dependency settings according to the process
 eflUB = UBOUND(embedFileList$, 2)
 FOR i = 0 TO eflUB
     IF embedFileList$(eflFile, i) <> "" AND embedFileList$(eflUsed, i) = "yes" THEN
-        IF ConvertFileToCArray%(embedFileList$(eflFile, i), embedFileList$(eflHand, i)) THEN
+        IF EmbedFileBinary%(embedFileList$(eflFile, i), embedFileList$(eflHand, i)) THEN
             SetDependency DEPENDENCY_ZLIB
         END IF
         SetDependency DEPENDENCY_EMBED
@@ -13518,11 +13519,26 @@ OPEN "A", #eflFF, tmpdir$ + "embedded.cpp"
 'append the internal retrieval function for _EMBEDDED$()
 PRINT #eflFF, "qbs *func__embedded(qbs *handle)"
 PRINT #eflFF, "{"
+PRINT #eflFF, "    switch (handle->len) {"
 FOR i = 0 TO eflUB
     IF embedFileList$(eflFile, i) <> "" AND embedFileList$(eflUsed, i) = "yes" THEN
-        PRINT #eflFF, "    if (qbs_equal(handle, qbs_new_txt("; AddQuotes$(embedFileList$(eflHand, i)); "))) {return GetArrayData_"; embedFileList$(eflHand, i); "();}"
+        'one case per handle length, emitted along with the first handle of that length
+        eflLen = LEN(embedFileList$(eflHand, i))
+        FOR eflJ = 0 TO i - 1
+            IF embedFileList$(eflFile, eflJ) <> "" AND embedFileList$(eflUsed, eflJ) = "yes" AND LEN(embedFileList$(eflHand, eflJ)) = eflLen THEN EXIT FOR
+        NEXT eflJ
+        IF eflJ = i THEN
+            PRINT #eflFF, "    case "; _TOSTR$(eflLen); ":"
+            FOR eflJ = i TO eflUB
+                IF embedFileList$(eflFile, eflJ) <> "" AND embedFileList$(eflUsed, eflJ) = "yes" AND LEN(embedFileList$(eflHand, eflJ)) = eflLen THEN
+                    PRINT #eflFF, "        if (!memcmp(handle->chr, "; AddQuotes$(embedFileList$(eflHand, eflJ)); ", "; _TOSTR$(eflLen); ")) return GetEmbeddedData_"; embedFileList$(eflHand, eflJ); "();"
+                END IF
+            NEXT eflJ
+            PRINT #eflFF, "        break;"
+        END IF
     END IF
 NEXT i
+PRINT #eflFF, "    }"
 PRINT #eflFF, "    return qbs_new_txt("; MKI$(&H2222); ");"
 PRINT #eflFF, "}"
 PRINT #eflFF, ""
@@ -13621,6 +13637,9 @@ FOR x = 1 TO ResolveStaticFunctions
     END IF
 NEXT x
 
+' Large programs get their SUBs and FUNCTIONs split into separately compiled units
+WriteCodeUnits makedeps$ + " " + CxxFlagsExtra$
+
 ' Delete existing qbx.o file, it ensures that it always gets rebuilt
 ON ERROR GOTO qberror_test
 IF tempfolderindex > 1 THEN
@@ -26421,7 +26440,10 @@ SUB setrefer (a2$, typ2 AS LONG, e2$, method AS LONG)
             END IF
             IF method = 0 THEN e$ = evaluatetotyp(e$, ISSTRING)
             IF Error_Happened THEN EXIT SUB
-            WriteBufLine MainTxtBuf, "qbs_set(" + r$ + "," + e$ + ");"
+            l$ = ""
+            IF (t AND ISFIXEDLENGTH) = 0 THEN l$ = stringappendcall$(r$, e$)
+            IF LEN(l$) = 0 THEN l$ = "qbs_set(" + r$ + "," + e$ + ")"
+            WriteBufLine MainTxtBuf, l$ + ";"
             WriteBufLine MainTxtBuf, cleanupstringprocessingcall$ + "0);"
             IF arrayprocessinghappened THEN arrayprocessinghappened = 0
             tlayout$ = tl$
@@ -26491,6 +26513,52 @@ SUB setrefer (a2$, typ2 AS LONG, e2$, method AS LONG)
     tlayout$ = tl$
 END SUB
 
+FUNCTION stringappendcall$ (dest$, e$)
+    'returns a qbs_append call if e$ adds to the end of dest$ (ie. a$ = a$ + b$ + ...), otherwise ""
+    'a$ + b$ + c$ is qbs_add(qbs_add(a$,b$),c$) so each right operand is closed by one of the leading calls
+    DIM adds AS LONG, i AS LONG, n AS LONG, start AS LONG, depth AS LONG, c AS LONG, quoted AS LONG
+    DIM arg$, operand$
+
+    i = 1
+    DO WHILE MID$(e$, i, 8) = "qbs_add("
+        adds = adds + 1
+        i = i + 8
+    LOOP
+    IF adds = 0 THEN EXIT FUNCTION
+    IF MID$(e$, i, LEN(dest$) + 1) <> dest$ + "," THEN EXIT FUNCTION
+    i = i + LEN(dest$) + 1
+
+    FOR n = 1 TO adds
+        start = i: depth = 0
+        DO
+            IF i > LEN(e$) THEN EXIT FUNCTION
+            c = ASC(e$, i)
+            IF quoted THEN
+                IF c = 92 THEN i = i + 1 'skip escaped character
+                IF c = 34 THEN quoted = 0
+            ELSE
+                IF c = 34 THEN quoted = 1
+                IF c = 40 THEN depth = depth + 1
+                IF c = 41 THEN
+                    IF depth = 0 THEN EXIT DO
+                    depth = depth - 1
+                END IF
+            END IF
+            i = i + 1
+        LOOP
+        operand$ = MID$(e$, start, i - start)
+        IF n = 1 THEN arg$ = operand$ ELSE arg$ = "qbs_add(" + arg$ + "," + operand$ + ")"
+        i = i + 1 'skip ')'
+        IF n < adds THEN
+            IF MID$(e$, i, 1) <> "," THEN EXIT FUNCTION
+            i = i + 1 'skip ','
+        END IF
+    NEXT
+    IF i <= LEN(e$) THEN EXIT FUNCTION
+
+    stringappendcall$ = "qbs_append(" + dest$ + "," + arg$ + ")"
+END FUNCTION
+
 FUNCTION uniquenumber&
     uniquenumbern = uniquenumbern + 1
     uniquenumber& = uniquenumbern
@@ -27477,96 +27545,38 @@ END FUNCTION
 '
 ' Inputs: sourcefile spec, unique handle (case sensitive)
 ' Return: 0 = normal embed, 1 = packed embed (DEPENDENCY_ZLIB required)
-FUNCTION ConvertFileToCArray% (file$, handle$)
+FUNCTION EmbedFileBinary% (file$, handle$)
     '--- read file contents ---
-    sff% = FREEFILE
     filedata$ = _READFILE$(file$)
+    binfile$ = "embed_" + handle$ + ".bin"
     '--- try to compress ---
     compdata$ = _DEFLATE$(filedata$)
     IF LEN(compdata$) < (LEN(filedata$) * 0.8) THEN
-        tmpfile$ = tmpdir$ + "embed.bin"
-        _WRITEFILE tmpfile$, compdata$
+        _WRITEFILE tmpdir$ + binfile$, compdata$
         packed% = 1
-        OPEN "B", #sff%, tmpfile$
     ELSE
+        _WRITEFILE tmpdir$ + binfile$, filedata$
         packed% = 0
-        OPEN "B", #sff%, file$
-    END IF
-    '--- init variables ---
-    fl& = LOF(sff%)
-    cntL& = INT(fl& / 32)
-    cntV& = INT(cntL& / 8180)
-    cntB& = (fl& - (cntL& * 32))
-    '--- create C-Array ---
+    END IF
+    '--- pull the bytes in with the assembler, the C++ parser never sees them ---
     dff% = FREEFILE
     OPEN "A", #dff%, tmpdir$ + "embedded.cpp"
-    '--- process LONGs ---
-    tmpI$ = SPACE$(32)
-    FOR vc& = 0 TO cntV&
-        IF vc& = cntV& THEN numL& = (cntL& MOD 8180): ELSE numL& = 8180
-        PRINT #dff%, "static const uint32_t "; handle$; "L"; _TOSTR$(vc&); "[] = {"
-        PRINT #dff%, "    "; _TOSTR$(numL& * 8); ","
-        FOR z& = 1 TO numL&
-            GET #sff%, , tmpI$: offI% = 1
-            tmpO$ = "    " + STRING$(88, ","): offO% = 5
-            DO
-                tmpL& = CVL(MID$(tmpI$, offI%, 4)): offI% = offI% + 4
-                MID$(tmpO$, offO%, 10) = "0x" + RIGHT$("00000000" + HEX$(tmpL&), 8)
-                offO% = offO% + 11
-            LOOP UNTIL offO% > 92
-            IF z& < numL& THEN PRINT #dff%, tmpO$: ELSE PRINT #dff%, LEFT$(tmpO$, 91)
-        NEXT z&
-        PRINT #dff%, "};"
-        PRINT #dff%, ""
-    NEXT vc&
-    '--- process remaining BYTEs ---
-    IF cntB& > 0 THEN
-        PRINT #dff%, "static const uint8_t "; handle$; "B[] = {"
-        PRINT #dff%, "    "; _TOSTR$(cntB&); ","
-        PRINT #dff%, "    ";
-        FOR x% = 1 TO cntB&
-            GET #sff%, , tmpB%%
-            PRINT #dff%, "0x" + RIGHT$("00" + HEX$(tmpB%%), 2);
-            IF x% <> 16 THEN
-                IF x% <> cntB& THEN PRINT #dff%, ",";
-            ELSE
-                IF x% <> cntB& THEN
-                    PRINT #dff%, ","
-                    PRINT #dff%, "    ";
-                END IF
-            END IF
-        NEXT x%
-        PRINT #dff%, ""
-        PRINT #dff%, "};"
-        PRINT #dff%, ""
-    END IF
+    PRINT #dff%, "EMBED_INCBIN(qb_embed_"; handle$; ", "; AddQuotes$(StrReplace$(tmpdir$, "\", "/") + binfile$); ");"
+    PRINT #dff%, ""
     '--- make a read function ---
-    PRINT #dff%, "qbs *GetArrayData_"; handle$; "(void)"
+    PRINT #dff%, "static qbs *GetEmbeddedData_"; handle$; "(void)"
     PRINT #dff%, "{"
-    PRINT #dff%, "    qbs  *data = qbs_new("; _TOSTR$(fl&); ", 1);"
-    PRINT #dff%, "    char *buff = (char*) data -> chr;"
-    PRINT #dff%, ""
-    FOR vc& = 0 TO cntV&
-        PRINT #dff%, "    memcpy(buff, &"; handle$; "L"; _TOSTR$(vc&); "[1], "; handle$; "L"; _TOSTR$(vc&); "[0] << 2);"
-        IF vc& < cntV& OR cntB& > 0 THEN
-            PRINT #dff%, "    buff += ("; handle$; "L"; _TOSTR$(vc&); "[0] << 2);"
-        END IF
-    NEXT vc&
-    IF cntB& > 0 THEN
-        PRINT #dff%, "    memcpy(buff, &"; handle$; "B[1], "; handle$; "B[0]);"
-    END IF
-    PRINT #dff%, ""
     IF packed% THEN
-        PRINT #dff%, "    return func__inflate(data, "; _TOSTR$(LEN(filedata$)); ", 1);"
+        PRINT #dff%, "    static uint8_t *inflated = nullptr;"
+        PRINT #dff%, "    return compression_inflate_view(qb_embed_"; handle$; ", "; _TOSTR$(LEN(compdata$)); ", "; _TOSTR$(LEN(filedata$)); ", &inflated);"
     ELSE
-        PRINT #dff%, "    return data;"
+        PRINT #dff%, "    return embed_view(qb_embed_"; handle$; ", "; _TOSTR$(LEN(filedata$)); ");"
     END IF
     PRINT #dff%, "}"
     PRINT #dff%, ""
     '--- ending ---
     CLOSE #dff%
-    CLOSE #sff%
-    ConvertFileToCArray% = packed%
+    EmbedFileBinary% = packed%
 END FUNCTION
 
 
@@ -28174,6 +28184,7 @@ END FUNCTION
 '$INCLUDE:'utilities\format.bas'
 '$INCLUDE:'utilities\terminal.bas'
 '$INCLUDE:'emit\logging.bas'
+'$INCLUDE:'emit\units.bas'
 
 DEFLNG A-Z
 
@@ -920,6 +920,17 @@ SUB reginternal
     id.hr_syntax = "_OPENCONNECTION(hostHandle)"
     regid
 
+    clearid
+    id.n = "_ConnectionWait": id.Dependency = DEPENDENCY_SOCKETS
+    id.subfunc = 1
+    id.callname = "func__connectionwait"
+    id.args = 2
+    id.arg = MKL$(DOUBLETYPE - ISPOINTER) + MKL$(LONGTYPE - ISPOINTER)
+    id.specialformat = "?[,?]"
+    id.ret = LONGTYPE - ISPOINTER
+    id.hr_syntax = "_CONNECTIONWAIT(timeout#[, handle&])"
+    regid
+
     clearid
     id.n = "_OpenClient": id.Dependency = DEPENDENCY_SOCKETS
     id.subfunc = 1
@@ -940,6 +951,16 @@ SUB reginternal
     id.hr_syntax = "_STATUSCODE(httpHandle&)"
     regid
 
+    clearid
+    id.n = "_HttpStats"
+    id.subfunc = 1
+    id.callname = "func__httpstats"
+    id.args = 1
+    id.arg = MKL$(STRINGTYPE - ISPOINTER)
+    id.ret = INTEGER64TYPE - ISPOINTER
+    id.hr_syntax = "_HTTPSTATS(statistic$)"
+    regid
+
     clearid
     id.n = "_EnvironCount"
     id.subfunc = 1
@@ -1176,6 +1197,40 @@ SUB reginternal
     id.hr_syntax = "_LOADIMAGE(fileName$[, [mode&][, requirements$]])"
     regid
 
+    clearid
+    id.n = "_LoadImageAsync"
+    id.Dependency = DEPENDENCY_IMAGE_CODEC
+    id.subfunc = 1
+    id.callname = "func__loadimageasync"
+    id.args = 3
+    id.arg = MKL$(STRINGTYPE - ISPOINTER) + MKL$(LONGTYPE - ISPOINTER) + MKL$(STRINGTYPE - ISPOINTER)
+    id.specialformat = "?[,[?][,?]]"
+    id.ret = LONGTYPE - ISPOINTER
+    id.hr_syntax = "_LOADIMAGEASYNC(fileName$[, [mode&][, requirements$]])"
+    regid
+
+    clearid
+    id.n = "_LoadImageReady"
+    id.Dependency = DEPENDENCY_IMAGE_CODEC
+    id.subfunc = 1
+    id.callname = "func__loadimageready"
+    id.args = 1
+    id.arg = MKL$(LONGTYPE - ISPOINTER)
+    id.ret = LONGTYPE - ISPOINTER
+    id.hr_syntax = "_LOADIMAGEREADY(ticket&)"
+    regid
+
+    clearid
+    id.n = "_LoadImageWait"
+    id.Dependency = DEPENDENCY_IMAGE_CODEC
+    id.subfunc = 1
+    id.callname = "func__loadimagewait"
+    id.args = 1
+    id.arg = MKL$(LONGTYPE - ISPOINTER)
+    id.ret = LONGTYPE - ISPOINTER
+    id.hr_syntax = "_LOADIMAGEWAIT(ticket&)"
+    regid
+
     clearid
     id.n = "_FreeImage"
     id.subfunc = 2
@@ -1208,6 +1263,27 @@ SUB reginternal
     id.hr_syntax = "_SAVEIMAGE fileName$[, imageHandle&][, requirements$])"
     regid
 
+    clearid
+    id.n = "_ScaleImage"
+    id.Dependency = DEPENDENCY_IMAGE_CODEC
+    id.subfunc = 2
+    id.callname = "sub__scaleimage"
+    id.args = 3
+    id.arg = MKL$(LONGTYPE - ISPOINTER) + MKL$(LONGTYPE - ISPOINTER) + MKL$(STRINGTYPE - ISPOINTER)
+    id.hr_syntax = "_SCALEIMAGE sourceHandle&, destHandle&, scaler$"
+    regid
+
+    clearid
+    id.n = "_ScaleImage"
+    id.Dependency = DEPENDENCY_IMAGE_CODEC
+    id.subfunc = 1
+    id.callname = "func__scaleimage"
+    id.args = 2
+    id.arg = MKL$(LONGTYPE - ISPOINTER) + MKL$(STRINGTYPE - ISPOINTER)
+    id.ret = LONGTYPE - ISPOINTER
+    id.hr_syntax = "_SCALEIMAGE(sourceHandle&, scaler$)"
+    regid
+
     'IMAGE SELECTION
 
     clearid
@@ -2132,6 +2208,28 @@ SUB reginternal
     id.hr_syntax = "_SNDRAWLEN [pipeHandle&]"
     regid
 
+    clearid
+    id.n = "_SndRawOverruns": id.Dependency = DEPENDENCY_MINIAUDIO
+    id.subfunc = 1
+    id.callname = "func__sndrawoverruns"
+    id.args = 1
+    id.arg = MKL$(LONGTYPE - ISPOINTER)
+    id.specialformat = "[?]"
+    id.ret = INTEGER64TYPE - ISPOINTER
+    id.hr_syntax = "count&& = _SNDRAWOVERRUNS[(pipeHandle&)]"
+    regid
+
+    clearid
+    id.n = "_SndRawUnderruns": id.Dependency = DEPENDENCY_MINIAUDIO
+    id.subfunc = 1
+    id.callname = "func__sndrawunderruns"
+    id.args = 1
+    id.arg = MKL$(LONGTYPE - ISPOINTER)
+    id.specialformat = "[?]"
+    id.ret = INTEGER64TYPE - ISPOINTER
+    id.hr_syntax = "count&& = _SNDRAWUNDERRUNS[(pipeHandle&)]"
+    regid
+
     clearid
     id.n = "_SndLen": id.Dependency = DEPENDENCY_MINIAUDIO
     id.subfunc = 1
@@ -2340,6 +2438,16 @@ SUB reginternal
     id.hr_syntax = "SEEK filenumber&, position"
     regid
 
+    clearid
+    id.n = "_Flush"
+    id.subfunc = 2
+    id.callname = "sub__flush"
+    id.args = 1
+    id.arg = MKL$(LONGTYPE - ISPOINTER)
+    id.specialformat = "[[#]?]"
+    id.hr_syntax = "_FLUSH [[#]fileNumber&]"
+    regid
+
     clearid
     id.n = "Seek"
     id.subfunc = 1
@@ -3209,6 +3317,36 @@ SUB reginternal
     id.hr_syntax = "LINE [STEP] [(column1, row1)]-[STEP] (column2, row2), color[, [{B|BF}], style%]"
     regid
 
+    clearid
+    id.n = "_PSetList"
+    id.subfunc = 2
+    id.callname = "sub__psetlist"
+    id.args = 2
+    id.arg = MKL$(UDTTYPE + (1)) + MKL$(OFFSETTYPE - ISPOINTER)
+    id.specialformat = "?[,?]"
+    id.hr_syntax = "_PSETLIST memBlock[, count&&]"
+    regid
+
+    clearid
+    id.n = "_LineList"
+    id.subfunc = 2
+    id.callname = "sub__linelist"
+    id.args = 2
+    id.arg = MKL$(UDTTYPE + (1)) + MKL$(OFFSETTYPE - ISPOINTER)
+    id.specialformat = "?[,?]"
+    id.hr_syntax = "_LINELIST memBlock[, count&&]"
+    regid
+
+    clearid
+    id.n = "_BoxList"
+    id.subfunc = 2
+    id.callname = "sub__boxlist"
+    id.args = 2
+    id.arg = MKL$(UDTTYPE + (1)) + MKL$(OFFSETTYPE - ISPOINTER)
+    id.specialformat = "?[,?]"
+    id.hr_syntax = "_BOXLIST memBlock[, count&&]"
+    regid
+
     clearid
     id.n = "Timer"
     id.subfunc = 1
@@ -4011,6 +4149,84 @@ SUB reginternal
     id.hr_syntax = "_INFLATE$(stringToDecompress$[, originalSize&])"
     regid
 
+    clearid
+    id.n = "_DeflateOpen"
+    id.Dependency = DEPENDENCY_ZLIB
+    id.subfunc = 1
+    id.callname = "func__deflateopen"
+    id.args = 1
+    id.arg = MKL$(LONGTYPE - ISPOINTER)
+    id.specialformat = "[?]"
+    id.ret = LONGTYPE - ISPOINTER
+    id.hr_syntax = "_DEFLATEOPEN[(compressionLevel&)]"
+    regid
+
+    clearid
+    id.n = "_DeflateChunk"
+    id.Dependency = DEPENDENCY_ZLIB
+    id.musthave = "$"
+    id.subfunc = 1
+    id.callname = "func__deflatechunk"
+    id.args = 3
+    id.arg = MKL$(LONGTYPE - ISPOINTER) + MKL$(STRINGTYPE - ISPOINTER) + MKL$(LONGTYPE - ISPOINTER)
+    id.specialformat = "?,?[,?]"
+    id.ret = STRINGTYPE - ISPOINTER
+    id.hr_syntax = "_DEFLATECHUNK$(streamHandle&, stringToCompress$[, finish&])"
+    regid
+
+    clearid
+    id.n = "_DeflateClose"
+    id.Dependency = DEPENDENCY_ZLIB
+    id.subfunc = 2
+    id.callname = "sub__deflateclose"
+    id.args = 1
+    id.arg = MKL$(LONGTYPE - ISPOINTER)
+    id.hr_syntax = "_DEFLATECLOSE streamHandle&"
+    regid
+
+    clearid
+    id.n = "_InflateOpen"
+    id.Dependency = DEPENDENCY_ZLIB
+    id.subfunc = 1
+    id.callname = "func__inflateopen"
+    id.args = 0
+    id.ret = LONGTYPE - ISPOINTER
+    id.hr_syntax = "_INFLATEOPEN"
+    regid
+
+    clearid
+    id.n = "_InflateChunk"
+    id.Dependency = DEPENDENCY_ZLIB
+    id.musthave = "$"
+    id.subfunc = 1
+    id.callname = "func__inflatechunk"
+    id.args = 2
+    id.arg = MKL$(LONGTYPE - ISPOINTER) + MKL$(STRINGTYPE - ISPOINTER)
+    id.ret = STRINGTYPE - ISPOINTER
+    id.hr_syntax = "_INFLATECHUNK$(streamHandle&, stringToDecompress$)"
+    regid
+
+    clearid
+    id.n = "_InflateEOF"
+    id.Dependency = DEPENDENCY_ZLIB
+    id.subfunc = 1
+    id.callname = "func__inflateeof"
+    id.args = 1
+    id.arg = MKL$(LONGTYPE - ISPOINTER)
+    id.ret = LONGTYPE - ISPOINTER
+    id.hr_syntax = "_INFLATEEOF(streamHandle&)"
+    regid
+
+    clearid
+    id.n = "_InflateClose"
+    id.Dependency = DEPENDENCY_ZLIB
+    id.subfunc = 2
+    id.callname = "sub__inflateclose"
+    id.args = 1
+    id.arg = MKL$(LONGTYPE - ISPOINTER)
+    id.hr_syntax = "_INFLATECLOSE streamHandle&"
+    regid
+
     clearid
     id.n = "_Md5"
     id.Dependency = DEPENDENCY_LOADFONT
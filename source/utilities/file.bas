@@ -13,6 +13,17 @@ FUNCTION CopyFile& (sourceFile$, destFile$)
     CopyFile& = E
 END FUNCTION
 
+'
+' Writes a file unless it already holds exactly the same content, in which case
+' the file and its timestamp are left alone (so make does not see it as changed)
+'
+SUB WriteFileIfChanged (fileName$, content$)
+    IF _FILEEXISTS(fileName$) THEN
+        IF _READFILE$(fileName$) = content$ THEN EXIT SUB
+    END IF
+    _WRITEFILE fileName$, content$
+END SUB
+
 '
 ' Splits the filename from its path, and returns the path
 '
@@ -0,0 +1,48 @@
+' Console pipe throughput benchmark
+' Runs itself with stdout redirected into a pipe and into a file, printing a few million short lines each time.
+' Console output that is not going to a terminal is block buffered, so this used to be one write (and flush) per line.
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+CHDIR _STARTDIR$ ' COMMAND$(0) is relative to where the benchmark was started
+
+CONST LINE_COUNT = 2000000
+
+DIM AS LONG i
+DIM AS DOUBLE startTime
+DIM AS STRING self, pipeTo, nullFile
+
+IF COMMAND$(1) = "emit" THEN
+    FOR i = 1 TO LINE_COUNT
+        PRINT "Line"; i
+    NEXT i
+    SYSTEM
+END IF
+
+self = CHR$(34) + COMMAND$(0) + CHR$(34) + " emit"
+
+$IF WIN THEN
+    pipeTo = " | find /c /v " + CHR$(34) + CHR$(34) + " > NUL"
+    nullFile = "NUL"
+$ELSE
+    pipeTo = " | wc -l > /dev/null"
+    nullFile = "/dev/null"
+$END IF
+
+startTime = TIMER(0.001)
+SHELL self + pipeTo
+PRINT USING "########## lines into a pipe:  #####.### ms"; LINE_COUNT; ElapsedMs(startTime)
+
+startTime = TIMER(0.001)
+SHELL self + " > " + nullFile
+PRINT USING "########## lines into a file:  #####.### ms"; LINE_COUNT; ElapsedMs(startTime)
+
+SYSTEM
+
+FUNCTION ElapsedMs# (startTime AS DOUBLE)
+    DIM elapsed AS DOUBLE
+
+    elapsed = TIMER(0.001) - startTime
+    IF elapsed < 0 THEN elapsed = elapsed + 86400 ' midnight rollover
+
+    ElapsedMs = elapsed * 1000
+END FUNCTION
@@ -0,0 +1,104 @@
+' Draw list benchmark
+' Draws 100,000 points, lines and filled boxes one statement at a time and then from a _MEM block with _PSETLIST,
+' _LINELIST and _BOXLIST.
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+TYPE PointRecord
+    x AS LONG
+    y AS LONG
+    c AS _UNSIGNED LONG
+END TYPE
+
+TYPE ShapeRecord
+    x1 AS LONG
+    y1 AS LONG
+    x2 AS LONG
+    y2 AS LONG
+    c AS _UNSIGNED LONG
+END TYPE
+
+CONST RECORD_COUNT = 100000
+
+DIM points(1 TO RECORD_COUNT) AS PointRecord
+DIM lines(1 TO RECORD_COUNT) AS ShapeRecord
+DIM boxes(1 TO RECORD_COUNT) AS ShapeRecord
+DIM AS LONG i, img
+DIM AS DOUBLE startTime
+DIM m AS _MEM
+
+RANDOMIZE 1
+FOR i = 1 TO RECORD_COUNT
+    points(i).x = INT(RND * 1920): points(i).y = INT(RND * 1080)
+    points(i).c = _RGB32(RND * 255, RND * 255, RND * 255)
+
+    lines(i).x1 = INT(RND * 1920): lines(i).y1 = INT(RND * 1080)
+    lines(i).x2 = lines(i).x1 + INT(RND * 64) - 32: lines(i).y2 = lines(i).y1 + INT(RND * 64) - 32
+    lines(i).c = _RGB32(RND * 255, RND * 255, RND * 255)
+
+    boxes(i).x1 = INT(RND * 1920): boxes(i).y1 = INT(RND * 1080)
+    boxes(i).x2 = boxes(i).x1 + INT(RND * 16): boxes(i).y2 = boxes(i).y1 + INT(RND * 16)
+    boxes(i).c = _RGBA32(RND * 255, RND * 255, RND * 255, 160)
+NEXT i
+
+img = _NEWIMAGE(1920, 1080, 32)
+_DEST img
+
+startTime = TIMER(0.001)
+FOR i = 1 TO RECORD_COUNT
+    PSET (points(i).x, points(i).y), points(i).c
+NEXT i
+_DEST _CONSOLE
+PRINT USING "PSET:       #####.### ms"; ElapsedMs(startTime)
+
+_DEST img
+startTime = TIMER(0.001)
+m = _MEM(points())
+_PSETLIST m
+_MEMFREE m
+_DEST _CONSOLE
+PRINT USING "__PSETLIST:  #####.### ms"; ElapsedMs(startTime)
+
+_DEST img
+startTime = TIMER(0.001)
+FOR i = 1 TO RECORD_COUNT
+    LINE (lines(i).x1, lines(i).y1)-(lines(i).x2, lines(i).y2), lines(i).c
+NEXT i
+_DEST _CONSOLE
+PRINT USING "LINE:       #####.### ms"; ElapsedMs(startTime)
+
+_DEST img
+startTime = TIMER(0.001)
+m = _MEM(lines())
+_LINELIST m
+_MEMFREE m
+_DEST _CONSOLE
+PRINT USING "__LINELIST:  #####.### ms"; ElapsedMs(startTime)
+
+_DEST img
+startTime = TIMER(0.001)
+FOR i = 1 TO RECORD_COUNT
+    LINE (boxes(i).x1, boxes(i).y1)-(boxes(i).x2, boxes(i).y2), boxes(i).c, BF
+NEXT i
+_DEST _CONSOLE
+PRINT USING "LINE BF:    #####.### ms"; ElapsedMs(startTime)
+
+_DEST img
+startTime = TIMER(0.001)
+m = _MEM(boxes())
+_BOXLIST m
+_MEMFREE m
+_DEST _CONSOLE
+PRINT USING "__BOXLIST:   #####.### ms"; ElapsedMs(startTime)
+
+_FREEIMAGE img
+SYSTEM
+
+FUNCTION ElapsedMs# (startTime AS DOUBLE)
+    DIM elapsed AS DOUBLE
+
+    elapsed = TIMER(0.001) - startTime
+    IF elapsed < 0 THEN elapsed = elapsed + 86400 ' midnight rollover
+
+    ElapsedMs = elapsed * 1000
+END FUNCTION
@@ -0,0 +1,46 @@
+' _LOADIMAGE benchmark
+' Loads one sample of each supported format repeatedly and prints the average time per load.
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+CHDIR _STARTDIR$ ' IMAGE_PATH is relative to the repository root, where the benchmark is started
+
+CONST IMAGE_PATH = "tests/compile_tests/image/"
+CONST LOADS_PER_FILE = 200
+
+DIM AS STRING fileName, format
+DIM AS LONG i, img, failed
+DIM AS DOUBLE startTime, elapsed
+
+PRINT "Format  File                        Load (ms)"
+
+READ format, fileName
+WHILE LEN(fileName) > 0
+    failed = 0
+    startTime = TIMER(0.001)
+
+    FOR i = 1 TO LOADS_PER_FILE
+        img = _LOADIMAGE(IMAGE_PATH + fileName, 32)
+        IF img < -1 THEN _FREEIMAGE img ELSE failed = failed + 1
+    NEXT i
+
+    elapsed = TIMER(0.001) - startTime
+    IF elapsed < 0 THEN elapsed = elapsed + 86400 ' midnight rollover
+
+    IF failed THEN
+        PRINT USING "\    \  \                        \  failed"; format; fileName
+    ELSE
+        PRINT USING "\    \  \                        \  ####.###"; format; fileName; elapsed * 1000 / LOADS_PER_FILE
+    END IF
+
+    READ format, fileName
+WEND
+
+SYSTEM
+
+DATA "BMP","lena.bmp"
+DATA "PCX","lena.pcx"
+DATA "WEBP","5.webp"
+DATA "ICO","x.ico"
+DATA "CUR","4bpp.cur"
+DATA "SVG","good1.svg"
+DATA "",""
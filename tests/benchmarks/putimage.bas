@@ -0,0 +1,89 @@
+' _PUTIMAGE software blit benchmark
+' Blits a sprite sheet with opaque, translucent and clear pixels many times and prints the average time per frame.
+' It also checks that the blended result matches blending the same sprite pixel by pixel with PSET (the scalar path).
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+CONST FRAMES = 100
+CONST SPRITE_SIZE = 64
+CONST SHEET_COLUMNS = 8
+
+DIM AS LONG sheet, frameImg, checkImg, i, x, y, dx, dy, r2, a
+DIM AS DOUBLE startTime, elapsed
+
+' Build a sheet of round sprites with a soft (translucent) edge and a clear background
+sheet = _NEWIMAGE(SPRITE_SIZE * SHEET_COLUMNS, SPRITE_SIZE, 32)
+_DEST sheet
+FOR y = 0 TO SPRITE_SIZE - 1
+    FOR x = 0 TO SPRITE_SIZE * SHEET_COLUMNS - 1
+        dx = (x MOD SPRITE_SIZE) - SPRITE_SIZE \ 2
+        dy = y - SPRITE_SIZE \ 2
+        r2 = dx * dx + dy * dy
+        IF r2 < 24 * 24 THEN
+            a = 255
+        ELSEIF r2 < 32 * 32 THEN
+            a = 255 * (32 * 32 - r2) \ (32 * 32 - 24 * 24)
+        ELSE
+            a = 0
+        END IF
+        _DONTBLEND
+        PSET (x, y), _RGBA32(x AND 255, y * 4, 255 - (x AND 255), a)
+        _BLEND
+    NEXT x
+NEXT y
+
+frameImg = _NEWIMAGE(1280, 720, 32)
+
+startTime = TIMER(0.001)
+FOR i = 1 TO FRAMES
+    _DEST frameImg
+    CLS , _RGB32(20, 40, 60)
+    FOR y = 0 TO 720 - SPRITE_SIZE STEP SPRITE_SIZE \ 2
+        FOR x = 0 TO 1280 - SPRITE_SIZE STEP SPRITE_SIZE \ 2
+            _PUTIMAGE (x, y), sheet, frameImg, (((x + y + i) MOD SHEET_COLUMNS) * SPRITE_SIZE, 0)-STEP(SPRITE_SIZE - 1, SPRITE_SIZE - 1)
+        NEXT x
+    NEXT y
+NEXT i
+elapsed = TIMER(0.001) - startTime
+IF elapsed < 0 THEN elapsed = elapsed + 86400 ' midnight rollover
+
+_DEST _CONSOLE
+PRINT USING "Frame with #### sprites: ####.### ms"; (1280 \ (SPRITE_SIZE \ 2) - 1) * (720 \ (SPRITE_SIZE \ 2) - 1); elapsed * 1000 / FRAMES
+
+' Verify the blit against the scalar PSET blend
+_DEST frameImg
+CLS , _RGBA32(90, 60, 30, 200)
+_PUTIMAGE (3, 5), sheet, frameImg
+
+checkImg = _NEWIMAGE(1280, 720, 32)
+_DEST checkImg
+CLS , _RGBA32(90, 60, 30, 200)
+_SOURCE sheet
+FOR y = 0 TO SPRITE_SIZE - 1
+    FOR x = 0 TO SPRITE_SIZE * SHEET_COLUMNS - 1
+        PSET (x + 3, y + 5), POINT(x, y)
+    NEXT x
+NEXT y
+
+DIM mismatches AS LONG
+DIM pixel AS _UNSIGNED LONG
+FOR y = 0 TO 719
+    FOR x = 0 TO 1279
+        _SOURCE frameImg
+        pixel = POINT(x, y)
+        _SOURCE checkImg
+        IF POINT(x, y) <> pixel THEN mismatches = mismatches + 1
+    NEXT x
+NEXT y
+
+_DEST _CONSOLE
+IF mismatches = 0 THEN
+    PRINT "Output matches the per-pixel path"
+ELSE
+    PRINT "Output differs from the per-pixel path in"; mismatches; "pixels!"
+END IF
+
+_FREEIMAGE checkImg
+_FREEIMAGE frameImg
+_FREEIMAGE sheet
+SYSTEM
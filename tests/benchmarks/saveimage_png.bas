@@ -0,0 +1,59 @@
+' _SAVEIMAGE PNG benchmark
+' Saves a 1080p screenshot-like image at every PNG compression level and prints the average time per save and the file size.
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+CONST SAVES_PER_LEVEL = 5
+CONST TEMP_FILE = "saveimage_png_benchmark.png"
+
+DIM AS LONG img, i, x, y, level, fileNum
+DIM AS DOUBLE startTime, elapsed
+DIM requirements AS STRING
+
+' Gradients, flat areas, text and some noise to look roughly like a real frame
+img = _NEWIMAGE(1920, 1080, 32)
+_DEST img
+FOR y = 0 TO 1079
+    LINE (0, y)-(1919, y), _RGB32(y \ 5, 64, 255 - y \ 5)
+NEXT y
+FOR i = 1 TO 200
+    LINE (RND * 1920, RND * 1080)-STEP(RND * 200, RND * 200), _RGB32(RND * 255, RND * 255, RND * 255), BF
+    CIRCLE (RND * 1920, RND * 1080), RND * 100, _RGB32(RND * 255, RND * 255, RND * 255)
+NEXT i
+FOR i = 1 TO 40
+    _PRINTSTRING (RND * 1700, RND * 1060), "The quick brown fox jumps over the lazy dog"
+NEXT i
+FOR i = 1 TO 20000
+    PSET (RND * 1920, RND * 1080), _RGB32(RND * 255, RND * 255, RND * 255)
+NEXT i
+_DEST _CONSOLE
+
+PRINT "Level  Save (ms)  Size (bytes)"
+
+FOR level = 0 TO 9
+    requirements = "png,level=" + _TOSTR$(level)
+
+    startTime = TIMER(0.001)
+    FOR i = 1 TO SAVES_PER_LEVEL
+        _SAVEIMAGE TEMP_FILE, img, requirements
+    NEXT i
+    elapsed = ElapsedMs(startTime) / SAVES_PER_LEVEL
+
+    fileNum = FREEFILE
+    OPEN TEMP_FILE FOR BINARY ACCESS READ AS fileNum
+    PRINT USING "  #    ####.###  ##########"; level; elapsed; LOF(fileNum)
+    CLOSE fileNum
+NEXT level
+
+KILL TEMP_FILE
+_FREEIMAGE img
+SYSTEM
+
+FUNCTION ElapsedMs# (startTime AS DOUBLE)
+    DIM elapsed AS DOUBLE
+
+    elapsed = TIMER(0.001) - startTime
+    IF elapsed < 0 THEN elapsed = elapsed + 86400 ' midnight rollover
+
+    ElapsedMs = elapsed * 1000
+END FUNCTION
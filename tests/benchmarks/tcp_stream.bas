@@ -0,0 +1,68 @@
+' TCP stream read benchmark
+' Connects to itself over the loopback interface, queues up a backlog of small fixed size messages and
+' reads them back one at a time with GET, which used to move the whole remaining backlog on every read.
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+CONST PORT = 47123
+CONST MESSAGE_SIZE = 16
+CONST MESSAGES_PER_CHUNK = 1024 ' 16KB per PUT
+CONST CHUNKS_PER_ROUND = 2 ' kept small so the OS socket buffers never fill up
+CONST ROUNDS = 500
+
+DIM AS LONG host, client, server, i, chunk, round, received, expected, bad
+DIM AS DOUBLE startTime, waitStart
+DIM chunkData AS STRING, message AS STRING * MESSAGE_SIZE
+
+host = _OPENHOST("TCP/IP:" + _TOSTR$(PORT))
+IF host = 0 THEN PRINT "Could not listen on port"; PORT: SYSTEM 1
+
+client = _OPENCLIENT("TCP/IP:" + _TOSTR$(PORT) + ":localhost")
+IF client = 0 THEN PRINT "Could not connect to port"; PORT: SYSTEM 1
+
+waitStart = TIMER(0.001)
+DO
+    server = _OPENCONNECTION(host)
+    IF server THEN EXIT DO
+    IF ElapsedMs(waitStart) > 5000 THEN PRINT "Timed out waiting for the connection": SYSTEM 1
+    _LIMIT 1000
+LOOP
+
+startTime = TIMER(0.001)
+FOR round = 1 TO ROUNDS
+    FOR chunk = 1 TO CHUNKS_PER_ROUND
+        chunkData = ""
+        FOR i = 1 TO MESSAGES_PER_CHUNK
+            chunkData = chunkData + MKL$(expected + (chunk - 1) * MESSAGES_PER_CHUNK + i - 1) + SPACE$(MESSAGE_SIZE - 4)
+        NEXT i
+        PUT #client, , chunkData
+    NEXT chunk
+
+    received = 0
+    waitStart = TIMER(0.001)
+    DO WHILE received < MESSAGES_PER_CHUNK * CHUNKS_PER_ROUND
+        GET #server, , message
+        IF EOF(server) THEN
+            IF ElapsedMs(waitStart) > 5000 THEN PRINT "Timed out waiting for data": SYSTEM 1
+        ELSE
+            IF CVL(LEFT$(message, 4)) <> expected THEN bad = bad + 1
+            expected = expected + 1
+            received = received + 1
+        END IF
+    LOOP
+NEXT round
+
+PRINT USING "Read ########## messages: #####.### ms"; expected; ElapsedMs(startTime)
+IF bad THEN PRINT bad; "messages arrived out of order!"
+
+CLOSE server, client, host
+SYSTEM
+
+FUNCTION ElapsedMs# (startTime AS DOUBLE)
+    DIM elapsed AS DOUBLE
+
+    elapsed = TIMER(0.001) - startTime
+    IF elapsed < 0 THEN elapsed = elapsed + 86400 ' midnight rollover
+
+    ElapsedMs = elapsed * 1000
+END FUNCTION
@@ -12,6 +12,9 @@ TEST_DEF_OBJS := tests/c/test.o
 # Defines the list of test sets
 TESTS += buffer
 TESTS += http
+TESTS += blit
+TESTS += logging
+TESTS += ring_queue
 
 # Describe how to build each test
 buffer.src-y := ./tests/c/buffer.cpp \
@@ -23,6 +26,25 @@ http.src-y := ./tests/c/http.cpp \
 				$(PATH_LIBQB)/src/threading-$(PLATFORM).cpp \
 				$(PATH_LIBQB)/src/threading.cpp
 
+blit.src-y := ./tests/c/blit.cpp \
+				$(PATH_LIBQB)/src/blit.cpp
+
+blit.cflags-y := -std=gnu++17 -O2
+
+logging.src-y := ./tests/c/logging.cpp \
+				$(PATH_LIBQB)/src/logging/async.cpp \
+				$(PATH_LIBQB)/src/logging/qb64pe_symbol.cpp \
+				$(PATH_LIBQB)/src/threading-$(PLATFORM).cpp \
+				$(PATH_LIBQB)/src/threading.cpp
+
+logging.cflags-y := -std=gnu++17 -I$(PATH_LIBQB)/src/logging
+logging.libs-$(lnx) += -lpthread
+
+ring_queue.src-y := ./tests/c/ring_queue.cpp
+
+ring_queue.cflags-y := -std=gnu++17 -O2
+ring_queue.libs-$(lnx) += -lpthread
+
 http.cflags-y := $(CURL_CXXFLAGS)
 http.libs-y := $(CURL_CXXLIBS)
 http.exe-libs-y := $(CURL_EXE_LIBS)
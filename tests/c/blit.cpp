@@ -0,0 +1,108 @@
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "test.h"
+#include "blit.h"
+#include "graphics.h"
+
+// The per-pixel _PUTIMAGE blend that the row kernels replace
+static uint32_t reference_blend(uint32_t dst, uint32_t src) {
+    switch (src & 0xFF000000) {
+    case 0xFF000000:
+        return src;
+    case 0x0:
+        return dst;
+    case 0x80000000:
+        return (((dst & 0xFEFEFE) + (src & 0xFEFEFE)) >> 1) + (image_blend_alpha(dst >> 24, 128) << 24);
+    case 0x7F000000:
+        return (((dst & 0xFEFEFE) + (src & 0xFEFEFE)) >> 1) + (image_blend_alpha(dst >> 24, 127) << 24);
+    default:
+        return image_blend_bgra(dst, src);
+    }
+}
+
+static uint32_t random_pixel() {
+    return uint32_t(rand() & 0xFFFF) | (uint32_t(rand() & 0xFFFF) << 16);
+}
+
+// Every length from 0 to 80 (so all vector widths and tails are covered) with random colors and a mix of the special alpha values
+void test_blend32_rows() {
+    static const uint32_t alphas[] = {0x00, 0xFF, 0x7F, 0x80, 0x01, 0xFE};
+
+    srand(1);
+
+    for (size_t count = 0; count <= 80; count++) {
+        char name[32];
+        snprintf(name, sizeof(name), "count-%d", int(count));
+
+        // offset by one pixel so that the kernels also see unaligned rows
+        std::vector<uint32_t> src(count + 1), dst(count + 1), expected;
+
+        for (size_t i = 0; i <= count; i++) {
+            auto alpha = (rand() & 1) ? alphas[rand() % 6] : uint32_t(rand() & 0xFF);
+            src[i] = (random_pixel() & 0xFFFFFF) | (alpha << 24);
+            dst[i] = random_pixel();
+        }
+
+        expected = dst;
+        for (size_t i = 1; i <= count; i++)
+            expected[i] = reference_blend(expected[i], src[i]);
+
+        image_blit_row_blend32(dst.data() + 1, src.data() + 1, count);
+
+        test_assert_buffers_with_name(name, (const char *)expected.data(), (const char *)dst.data(), expected.size() * sizeof(uint32_t));
+    }
+}
+
+// Whole runs of opaque and fully transparent pixels take the vector kernels' shortcuts
+void test_blend32_opaque_and_clear() {
+    std::vector<uint32_t> src(64), dst(64, 0x80112233), expected(64);
+
+    for (size_t i = 0; i < 64; i++) {
+        src[i] = (i < 32) ? (0xFF000000 | uint32_t(i)) : uint32_t(i);
+        expected[i] = (i < 32) ? src[i] : 0x80112233;
+    }
+
+    image_blit_row_blend32(dst.data(), src.data(), dst.size());
+
+    test_assert_buffers((const char *)expected.data(), (const char *)dst.data(), expected.size() * sizeof(uint32_t));
+}
+
+void test_keyed8_rows() {
+    srand(2);
+
+    for (size_t count = 0; count <= 80; count++) {
+        char name[32];
+        snprintf(name, sizeof(name), "count-%d", int(count));
+
+        std::vector<uint8_t> src(count + 1), dst(count + 1), expected;
+
+        for (size_t i = 0; i <= count; i++) {
+            src[i] = uint8_t(rand() % 4);
+            dst[i] = uint8_t(rand());
+        }
+
+        expected = dst;
+        for (size_t i = 1; i <= count; i++) {
+            if (src[i] != 2)
+                expected[i] = src[i];
+        }
+
+        image_blit_row_keyed8(dst.data() + 1, src.data() + 1, count, 2);
+
+        test_assert_buffers_with_name(name, (const char *)expected.data(), (const char *)dst.data(), expected.size());
+    }
+}
+
+int main() {
+    struct unit_test tests[] = {
+        { test_blend32_rows, "test-blend32-rows" },
+        { test_blend32_opaque_and_clear, "test-blend32-opaque-and-clear" },
+        { test_keyed8_rows, "test-keyed8-rows" },
+    };
+
+    return run_tests("blit", tests, sizeof(tests) / sizeof(*tests));
+}
@@ -303,6 +303,52 @@ void test_read_write_interweaved() {
     libqb_buffer_clear(&buffer);
 }
 
+// Writes and reads that span several chunks, repeated so that spare chunks get reused
+void test_large_rw() {
+    struct libqb_buffer buffer;
+
+    libqb_buffer_init(&buffer);
+
+    static char data[LIBQB_BUFFER_CHUNK_SIZE * 5 + 123];
+    static char read_buf[sizeof(data)];
+
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = (char)(i % 251);
+
+    for (int round = 0; round < 3; round++) {
+        char id[20];
+        snprintf(id, sizeof(id), "%d", round);
+
+        // Write in uneven pieces, so the chunk boundaries fall in the middle of writes
+        size_t written = 0;
+        const size_t write_sizes[] = {1, 1000, LIBQB_BUFFER_CHUNK_SIZE * 2 + 7, 333, LIBQB_BUFFER_CHUNK_SIZE - 1};
+
+        for (int i = 0; written < sizeof(data); i = (i + 1) % 5) {
+            size_t len = write_sizes[i];
+            if (len > sizeof(data) - written)
+                len = sizeof(data) - written;
+
+            libqb_buffer_write(&buffer, data + written, len);
+            written += len;
+        }
+
+        test_assert_ints_with_name(id, sizeof(data), libqb_buffer_length(&buffer));
+
+        // Read it back in different pieces
+        size_t read = 0;
+        const size_t read_sizes[] = {LIBQB_BUFFER_CHUNK_SIZE + 11, 5, 4096};
+
+        for (int i = 0; read < sizeof(data); i = (i + 1) % 3)
+            read += libqb_buffer_read(&buffer, read_buf + read, read_sizes[i]);
+
+        test_assert_ints_with_name(id, sizeof(data), read);
+        test_assert_ints_with_name(id, 0, libqb_buffer_length(&buffer));
+        test_assert_buffers_with_name(id, data, read_buf, sizeof(data));
+    }
+
+    libqb_buffer_clear(&buffer);
+}
+
 int main() {
     struct unit_test tests[] = {
         { test_single_rw, "test-single-read-write" },
@@ -312,6 +358,7 @@ int main() {
         { test_read_past_end, "test-read-past-end" },
         { test_read_write_multiple_partial, "test-read-write-multiple-partial" },
         { test_read_write_interweaved, "test-read-write-interweaved" },
+        { test_large_rw, "test-large-read-write" },
     };
 
     return run_tests("buffer", tests, sizeof(tests) / sizeof(*tests));
@@ -4,6 +4,14 @@
 #include <string.h>
 #include <unistd.h>
 
+#ifndef _WIN32
+#    include <arpa/inet.h>
+#    include <chrono>
+#    include <netinet/in.h>
+#    include <sys/socket.h>
+#    include <thread>
+#endif
+
 #include "qb_http.h"
 #include "test.h"
 
@@ -51,12 +59,214 @@ void test_http() {
     }
 }
 
+#ifndef _WIN32
+// A minimal HTTP/1.1 server that answers every request on a connection with "hello" and counts the connections
+struct keepalive_server {
+    int fd;
+    int port;
+    int requests;
+    int connections;
+
+    void run(int expected_requests) {
+        while (requests < expected_requests) {
+            int con = accept(fd, NULL, NULL);
+            if (con < 0)
+                return;
+
+            connections++;
+
+            char buf[4096];
+            size_t used = 0;
+            ssize_t n;
+
+            while (requests < expected_requests && (n = recv(con, buf + used, sizeof(buf) - used, 0)) > 0) {
+                used += n;
+
+                // Answer each complete request header that has arrived so far
+                char *end;
+                while ((end = (char *)memmem(buf, used, "\r\n\r\n", 4))) {
+                    const char *response = "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello";
+                    send(con, response, strlen(response), 0);
+                    requests++;
+
+                    size_t consumed = end + 4 - buf;
+                    memmove(buf, buf + consumed, used - consumed);
+                    used -= consumed;
+                }
+            }
+
+            close(con);
+        }
+    }
+};
+
+void test_http_keepalive() {
+    keepalive_server server = {};
+    const int request_count = 10;
+
+    server.fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    socklen_t addr_len = sizeof(addr);
+    bind(server.fd, (struct sockaddr *)&addr, sizeof(addr));
+    listen(server.fd, 16);
+    getsockname(server.fd, (struct sockaddr *)&addr, &addr_len);
+    server.port = ntohs(addr.sin_port);
+
+    std::thread server_thread(&keepalive_server::run, &server, request_count);
+
+    struct libqb_http_stats before, after;
+    libqb_http_get_stats(&before);
+
+    char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%d/", server.port);
+
+    for (int i = 0; i < request_count; i++) {
+        int err = libqb_http_open(url, 1);
+        test_assert_ints_with_name(url, 0, err);
+
+        while (libqb_http_connected(1))
+            usleep(10);
+
+        char buf[16];
+        size_t buflen = sizeof(buf);
+        err = libqb_http_get(1, buf, &buflen);
+        test_assert_ints_with_name(url, 0, err);
+        test_assert_ints_with_name(url, 5, buflen);
+        test_assert_buffers_with_name(url, "hello", buf, 5);
+
+        libqb_http_close(1);
+    }
+
+    server_thread.join();
+    close(server.fd);
+
+    libqb_http_get_stats(&after);
+
+    test_assert_ints(request_count, server.requests);
+    test_assert_ints(1, server.connections);
+    test_assert_ints(request_count, after.requests - before.requests);
+    test_assert_ints(1, after.connections - before.connections);
+    test_assert_ints(request_count - 1, after.reused_connections - before.reused_connections);
+}
+
+// Serves one response with a large body, to check the download is paused while the data isn't being read
+static void send_large_response(int fd, size_t body_length) {
+    int con = accept(fd, NULL, NULL);
+    if (con < 0)
+        return;
+
+    char buf[16 * 1024];
+    recv(con, buf, sizeof(buf), 0); // the request is small enough to arrive in one piece
+
+    int len = snprintf(buf, sizeof(buf), "HTTP/1.1 200 OK\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n", body_length);
+    send(con, buf, len, 0);
+
+    for (size_t sent = 0; sent < body_length;) {
+        size_t n = body_length - sent < sizeof(buf) ? body_length - sent : sizeof(buf);
+
+        for (size_t i = 0; i < n; i++)
+            buf[i] = (char)((sent + i) % 251);
+
+        ssize_t ret = send(con, buf, n, 0);
+        if (ret <= 0)
+            break;
+
+        sent += ret;
+    }
+
+    close(con);
+}
+
+void test_http_backpressure() {
+    const size_t body_length = 64 * 1024 * 1024;
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    socklen_t addr_len = sizeof(addr);
+    bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+    listen(fd, 1);
+    getsockname(fd, (struct sockaddr *)&addr, &addr_len);
+
+    std::thread server_thread(send_large_response, fd, body_length);
+
+    char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%d/", ntohs(addr.sin_port));
+
+    int err = libqb_http_open(url, 1);
+    test_assert_ints_with_name(url, 0, err);
+
+    // Give the download time to run ahead of us, it should stop at the high-water mark
+    usleep(500 * 1000);
+
+    size_t buffered = 0;
+    libqb_http_get_length(1, &buffered);
+    test_assert_with_name(url, buffered < 8 * 1024 * 1024);
+    test_assert_with_name(url, libqb_http_connected(1));
+
+    // Now read everything back, the download has to continue as we go
+    static char buf[256 * 1024];
+    size_t total = 0;
+    int bad = 0;
+    bool timed_out = false;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+
+    while (true) {
+        size_t buflen = sizeof(buf);
+        err = libqb_http_get(1, buf, &buflen);
+        if (err)
+            break;
+
+        for (size_t i = 0; i < buflen; i++)
+            if (buf[i] != (char)((total + i) % 251))
+                bad++;
+
+        total += buflen;
+
+        if (!buflen) {
+            if (!libqb_http_connected(1) && total == body_length)
+                break;
+
+            // The download stalled or the connection dropped early, don't wait forever
+            if (std::chrono::steady_clock::now() > deadline) {
+                timed_out = true;
+                break;
+            }
+
+            usleep(100);
+        }
+    }
+
+    test_assert_with_name("timed out waiting for the download to finish", !timed_out);
+    test_assert_ints_with_name(url, 0, err);
+    test_assert_ints_with_name(url, body_length, total);
+    test_assert_ints_with_name(url, 0, bad);
+
+    libqb_http_close(1);
+
+    server_thread.join();
+    close(fd);
+}
+#endif
+
 int main() {
     libqb_http_init();
 
     int ret;
     struct unit_test tests[] = {
         {test_http, "http"},
+#ifndef _WIN32
+        {test_http_keepalive, "http keep-alive"},
+        {test_http_backpressure, "http backpressure"},
+#endif
     };
 
     ret = run_tests("http", tests, sizeof(tests) / sizeof(*tests));
@@ -0,0 +1,182 @@
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <atomic>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test.h"
+#include "datetime.h"
+#include "logging.h"
+#include "logging_private.h"
+
+int64_t GetTicks() {
+    return 0;
+}
+
+// Collects everything the async writer hands to it
+class capture_handler : public log_handler {
+  public:
+    std::vector<std::string> messages;
+    std::vector<std::string> funcs;
+    int flushes = 0;
+    bool batched = false;
+
+    std::atomic<size_t> written{0};
+
+    // While set, write() waits until it is cleared
+    std::atomic<bool> hold{false};
+    std::atomic<bool> holding{false};
+
+    virtual void write(struct log_entry *entry) {
+        holding = true;
+        while (hold)
+            std::this_thread::yield();
+        holding = false;
+
+        messages.push_back(entry->message);
+        funcs.push_back(entry->func);
+        written++;
+    }
+
+    virtual void flush() {
+        flushes++;
+    }
+
+    virtual void set_batched() {
+        batched = true;
+    }
+};
+
+static bool push(async_log_dispatcher *dispatcher, const char *func, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    bool ret = dispatcher->push(loglevel::Information, logscope::Libqb, 0, __FILE__, func, __LINE__, fmt, args, nullptr);
+    va_end(args);
+
+    return ret;
+}
+
+// Every entry from every thread arrives, and each thread's entries stay in order
+void test_async_multiple_producers() {
+    const int threads = 4;
+    const int per_thread = 10000;
+
+    capture_handler handler;
+    std::list<log_handler *> handlers = { &handler };
+    async_log_dispatcher dispatcher(&handlers);
+
+    test_assert(handler.batched);
+
+    std::atomic<size_t> pushed{0};
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; t++) {
+        producers.emplace_back([&dispatcher, &handler, &pushed, t]() {
+            for (int i = 0; i < per_thread; i++) {
+                // Don't outrun the writer, this test is about ordering not drops
+                while (pushed - handler.written >= 1024)
+                    std::this_thread::yield();
+
+                pushed++;
+                push(&dispatcher, "producer", "%d %d", t, i);
+            }
+        });
+    }
+
+    for (auto &producer : producers)
+        producer.join();
+
+    dispatcher.stop();
+
+    int next[threads] = { 0 };
+    bool in_order = true;
+
+    for (auto &msg : handler.messages) {
+        int t, i;
+        if (sscanf(msg.c_str(), "%d %d", &t, &i) != 2 || t < 0 || t >= threads) {
+            in_order = false;
+            continue;
+        }
+
+        if (i != next[t])
+            in_order = false;
+
+        next[t] = i + 1;
+    }
+
+    size_t dropped = 0;
+    for (auto &msg : handler.messages)
+        if (strstr(msg.c_str(), "dropped"))
+            dropped++;
+
+    test_assert_ints(0, dropped);
+    test_assert_ints(threads * per_thread, handler.messages.size());
+    test_assert(in_order);
+    test_assert(handler.flushes > 0);
+    test_assert((size_t)handler.flushes < handler.messages.size()); // Flushed per batch, not per entry
+}
+
+// A full ring drops new entries instead of waiting, and the drops get reported
+void test_async_drops() {
+    capture_handler handler;
+    std::list<log_handler *> handlers = { &handler };
+    async_log_dispatcher dispatcher(&handlers);
+
+    handler.hold = true;
+    push(&dispatcher, "first", "first");
+
+    // The writer has taken the first entry and is now stuck in write()
+    while (!handler.holding)
+        std::this_thread::yield();
+
+    const int extra = 3000;
+    bool accepted = true;
+    for (int i = 0; i < extra; i++)
+        accepted = push(&dispatcher, "fill", "fill %d", i) && accepted;
+
+    test_assert(accepted);
+
+    handler.hold = false;
+    dispatcher.stop();
+
+    // Entries pushed after stop() are left to the caller
+    test_assert(!push(&dispatcher, "late", "late"));
+
+    const int queued = 2048; // RING_SIZE
+    test_assert_ints(1 + queued + 1, handler.messages.size());
+    test_assert_buffers("fill 2047", handler.messages[queued].c_str(), 10);
+
+    char expected[100];
+    snprintf(expected, sizeof(expected), "%d log entries were dropped because the log queue was full", extra - queued);
+    test_assert_buffers(expected, handler.messages.back().c_str(), strlen(expected) + 1);
+}
+
+// QB64 function names are resolved on the writer thread
+void test_async_symbols() {
+    capture_handler handler;
+    std::list<log_handler *> handlers = { &handler };
+    async_log_dispatcher dispatcher(&handlers);
+
+    push(&dispatcher, "SUB_FOO", "a");
+    push(&dispatcher, "some_function", "b");
+    dispatcher.stop();
+
+    test_assert_ints(2, handler.funcs.size());
+    test_assert_buffers("FOO (QB64)", handler.funcs[0].c_str(), 11);
+    test_assert_buffers("some_function", handler.funcs[1].c_str(), 14);
+}
+
+int main() {
+    struct unit_test tests[] = {
+        { test_async_multiple_producers, "test-async-multiple-producers" },
+        { test_async_drops, "test-async-drops" },
+        { test_async_symbols, "test-async-symbols" },
+    };
+
+    return run_tests("logging", tests, sizeof(tests) / sizeof(*tests));
+}
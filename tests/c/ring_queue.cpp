@@ -0,0 +1,151 @@
+
+#include <stddef.h>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#include "test.h"
+#include "ring_queue.h"
+
+static auto counting(int first) {
+    return [first](size_t i) { return first + int(i); };
+}
+
+// Pops everything that is queued and checks it continues the sequence starting at next
+static int pop_all(libqb_ring_queue<int> &queue, int next) {
+    int buf[5];
+    size_t n;
+
+    while ((n = queue.pop(buf, 5)) != 0) {
+        for (size_t i = 0; i < n; i++, next++)
+            test_assert_ints(next, buf[i]);
+    }
+
+    return next;
+}
+
+// The capacity is rounded up to a power of two
+void test_capacity() {
+    libqb_ring_queue<int> a(1), b(8), c(9);
+
+    test_assert_ints(1, a.capacity());
+    test_assert_ints(8, b.capacity());
+    test_assert_ints(16, c.capacity());
+}
+
+// Items come out in the order they went in
+void test_push_pop() {
+    libqb_ring_queue<int> queue(8);
+    int buf[8];
+
+    test_assert_ints(0, queue.size());
+    test_assert_ints(0, queue.pop(buf, 8));
+
+    test_assert(!queue.push(3, counting(1)));
+    test_assert_ints(3, queue.size());
+
+    test_assert_ints(2, queue.pop(buf, 2));
+    test_assert_ints(1, buf[0]);
+    test_assert_ints(2, buf[1]);
+    test_assert_ints(1, queue.size());
+
+    test_assert_ints(1, queue.pop(buf, 8));
+    test_assert_ints(3, buf[0]);
+    test_assert_ints(0, queue.size());
+}
+
+// The indices keep running past the end of the ring, pops that cross the end come out in one piece
+void test_wraparound() {
+    libqb_ring_queue<int> queue(8);
+    int buf[8];
+    int next = 0;
+
+    for (int round = 0; round < 100; round++) {
+        char id[20];
+        snprintf(id, sizeof(id), "round %d", round);
+
+        test_assert_with_name(id, !queue.push(5, counting(next)));
+        test_assert_ints_with_name(id, 5, queue.pop(buf, 8));
+
+        for (int i = 0; i < 5; i++)
+            test_assert_ints_with_name(id, next + i, buf[i]);
+
+        next += 5;
+    }
+
+    test_assert_ints(0, queue.size());
+}
+
+// Pushing more than fits spills into the overflow vector, nothing is lost or reordered
+void test_overflow() {
+    libqb_ring_queue<int> queue(8);
+    int buf[8];
+
+    test_assert(queue.push(20, counting(0)));
+    test_assert(queue.spilling());
+    test_assert_ints(20, queue.size());
+
+    // Further pushes queue up behind the overflow and don't count as new spills
+    test_assert(!queue.push(4, counting(20)));
+    test_assert_ints(24, queue.size());
+
+    // A pop refills the ring from the overflow vector
+    test_assert_ints(8, queue.pop(buf, 8));
+    for (int i = 0; i < 8; i++)
+        test_assert_ints(i, buf[i]);
+    test_assert_ints(16, queue.size());
+
+    test_assert_ints(24, pop_all(queue, 8));
+    test_assert(!queue.spilling());
+    test_assert_ints(0, queue.size());
+
+    // Once drained, the ring is used directly again and a new spill is reported
+    test_assert(!queue.push(8, counting(0)));
+    test_assert(queue.push(1, counting(8)));
+    test_assert_ints(9, pop_all(queue, 0));
+}
+
+// One thread pushes a long sequence in uneven chunks while another pops it
+void test_threaded() {
+    const int total = 1000000;
+    libqb_ring_queue<int> queue(64);
+    int next = 0;
+    bool inOrder = true;
+
+    std::thread consumer([&queue, &next, &inOrder]() {
+        int buf[37];
+
+        while (next < total) {
+            auto n = queue.pop(buf, 37);
+            for (size_t i = 0; i < n; i++, next++)
+                inOrder = inOrder && buf[i] == next;
+
+            if (!n)
+                std::this_thread::yield();
+        }
+    });
+
+    for (int sent = 0; sent < total;) {
+        auto n = std::min(total - sent, 1 + sent % 97);
+        queue.push(n, counting(sent));
+        sent += n;
+    }
+
+    consumer.join();
+
+    test_assert_ints(total, next);
+    test_assert(inOrder);
+    test_assert_ints(0, queue.size());
+}
+
+int main() {
+    struct unit_test tests[] = {
+        { test_capacity, "test-capacity" },
+        { test_push_pop, "test-push-pop" },
+        { test_wraparound, "test-wraparound" },
+        { test_overflow, "test-overflow" },
+        { test_threaded, "test-threaded" },
+    };
+
+    return run_tests("ring_queue", tests, sizeof(tests) / sizeof(*tests));
+}
@@ -0,0 +1,37 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+DIM AS LONG h, rate
+DIM AS DOUBLE startTime
+
+h = _SNDOPENRAW
+rate = _SNDRATE
+
+PRINT "Overruns at start:"; _SNDRAWOVERRUNS(h)
+PRINT "Underruns at start:"; _SNDRAWUNDERRUNS(h)
+
+' The queue's ring holds about two seconds, so four seconds in one go has to spill over
+REDIM samples(0 TO rate * 4 - 1) AS SINGLE
+_SNDRAWBATCH samples(), 1, h
+PRINT "Overruns after a long push:"; _SNDRAWOVERRUNS(h)
+
+' Pushing more while the queue is still spilling over is the same overrun
+_SNDRAWBATCH samples(), 1, h
+PRINT "Overruns after another push:"; _SNDRAWOVERRUNS(h)
+PRINT "Nothing dropped:"; _SNDRAWLEN(h) > 7
+_SNDCLOSE h
+
+' A short burst that is played to the end starves the device once
+h = _SNDOPENRAW
+REDIM samples(0 TO rate \ 10 - 1) AS SINGLE
+_SNDRAWBATCH samples(), 1, h
+
+startTime = TIMER(0.001)
+DO WHILE _SNDRAWUNDERRUNS(h) = 0 AND ABS(TIMER(0.001) - startTime) < 5
+    _LIMIT 100
+LOOP
+PRINT "Underruns after playing out:"; _SNDRAWUNDERRUNS(h)
+PRINT "Default pipe:"; _SNDRAWUNDERRUNS; _SNDRAWOVERRUNS
+_SNDCLOSE h
+
+SYSTEM
@@ -0,0 +1,31 @@
+$CONSOLE:ONLY
+
+' Console output is block-buffered when it is not a terminal, as it is here. INPUT$ must still flush it before it
+' waits for a key, so that a prompt is seen before the program blocks.
+
+IF COMMAND$(1) = "--child" THEN
+    ' Nobody types anything, the timer ends the wait
+    ON TIMER(2) GOSUB quit
+    TIMER ON
+
+    PRINT "prompt"
+    k$ = INPUT$(1)
+    SYSTEM
+
+    quit:
+    PRINT "timed out"
+    SYSTEM
+END IF
+
+PRINT "before"
+SHELL _DONTWAIT CHR$(34) + COMMAND$(0) + CHR$(34) + " --child"
+
+' The child shares our output and is waiting in INPUT$ by now, so its prompt has to be there already
+_DELAY 1
+PRINT "while waiting"
+_FLUSH
+
+_DELAY 3
+PRINT "after"
+
+SYSTEM
@@ -0,0 +1,25 @@
+$EMBED:'./test.output','txt'
+$EMBED:'./test.bas','src'
+$EMBED:'./multi_handle.bas','self'
+
+$CONSOLE
+$SCREENHIDE
+_DEST _CONSOLE
+
+' "txt" and "src" have the same length and share a case of the generated lookup
+a$ = _EMBEDDED$("txt")
+PRINT LEFT$(a$, LEN(a$) - 1)
+PRINT LEFT$(_EMBEDDED$("src"), 7)
+PRINT MID$(_EMBEDDED$("self"), 2, 5)
+
+' This file deflates well, so it is inflated on the first call and handed out from then on
+IF _EMBEDDED$("self") = _EMBEDDED$("self") THEN PRINT "Same content"
+IF INSTR(_EMBEDDED$("self"), "This file deflates well") THEN PRINT "Found comment"
+
+' The strings returned are read-only views, changes only ever reach copies
+MID$(a$, 1, 4) = "That"
+PRINT LEFT$(a$, 9)
+PRINT LEFT$(UCASE$(_EMBEDDED$("txt")), 9)
+PRINT LEFT$(_EMBEDDED$("txt"), 9)
+
+SYSTEM
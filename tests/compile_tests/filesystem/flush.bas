@@ -0,0 +1,44 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+CONST TEST_FILE = "flush_test.tmp"
+
+DIM i AS LONG, l AS STRING
+
+CHDIR _STARTDIR$
+
+OPEN TEST_FILE FOR OUTPUT AS #1 LEN = 16
+FOR i = 1 TO 3
+    PRINT #1, "Line" + STR$(i)
+NEXT
+_FLUSH #1
+
+' A second handle only sees what has been flushed
+OPEN TEST_FILE FOR INPUT AS #2
+DO UNTIL EOF(2)
+    LINE INPUT #2, l
+    PRINT "Read: ["; l; "]"
+LOOP
+CLOSE #2
+
+PRINT #1, "Line 4";
+PRINT "LOF:"; LOF(1)
+WRITE #1, 5, "six"
+_FLUSH
+PRINT "LOF after _FLUSH:"; LOF(1)
+CLOSE #1
+
+OPEN TEST_FILE FOR APPEND AS #1
+PRINT #1, "Line 7"
+CLOSE #1
+
+OPEN TEST_FILE FOR INPUT AS #2
+DO UNTIL EOF(2)
+    LINE INPUT #2, l
+    PRINT "Read: ["; l; "]"
+LOOP
+CLOSE #2
+
+KILL TEST_FILE
+
+SYSTEM
@@ -0,0 +1,62 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+CONST TEST_FILE = "line_input_test.tmp"
+
+DIM f AS LONG, i AS LONG, count AS LONG, mismatches AS LONG
+DIM l AS STRING, a AS LONG, b AS STRING, c AS SINGLE
+
+CHDIR _STARTDIR$
+
+' Mixed line endings, CHR$(26) marks the end of the text
+f = FREEFILE
+OPEN TEST_FILE FOR OUTPUT AS #f
+PRINT #f, "one"; CHR$(13); CHR$(10); "two"; CHR$(10); "three"; CHR$(13); "four"; CHR$(13); CHR$(13); "six"; CHR$(26); "hidden";
+CLOSE #f
+
+OPEN TEST_FILE FOR INPUT AS #f
+DO UNTIL EOF(f)
+    LINE INPUT #f, l
+    count = count + 1
+    PRINT "Line"; count; "= ["; l; "]"
+LOOP
+CLOSE #f
+
+' Enough lines to cross several read-ahead buffer boundaries
+OPEN TEST_FILE FOR OUTPUT AS #f
+FOR i = 1 TO 100000
+    PRINT #f, "Line number" + STR$(i)
+NEXT
+CLOSE #f
+
+count = 0
+OPEN TEST_FILE FOR INPUT AS #f
+DO UNTIL EOF(f)
+    LINE INPUT #f, l
+    count = count + 1
+    IF l <> "Line number" + STR$(count) THEN mismatches = mismatches + 1
+LOOP
+PRINT "Lines read:"; count
+PRINT "Mismatches:"; mismatches
+
+SEEK #f, 1
+LINE INPUT #f, l
+PRINT "After SEEK: ["; l; "]"
+LINE INPUT #f, l
+PRINT "Next line: ["; l; "]"
+PRINT "SEEK:"; SEEK(f)
+CLOSE #f
+
+OPEN TEST_FILE FOR OUTPUT AS #f
+WRITE #f, 42, "a,b", 2.5
+CLOSE #f
+
+OPEN TEST_FILE FOR INPUT AS #f
+INPUT #f, a, b, c
+PRINT a; "["; b; "]"; c
+PRINT "EOF:"; EOF(f)
+CLOSE #f
+
+KILL TEST_FILE
+
+SYSTEM
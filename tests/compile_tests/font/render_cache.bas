@@ -0,0 +1,60 @@
+OPTION _EXPLICIT
+$CONSOLE:ONLY
+CHDIR _STARTDIR$
+
+' Rendered strings are cached per font, so drawing the same string again has to give the same pixels as the first
+' time, also after enough other strings were drawn to push it out of the cache
+
+CONST FONT_FILE = "LiberationSans-Regular.ttf"
+CONST SAMPLE_TEXT = "The quick brown fox jumps over the lazy dog 0123456789"
+
+DIM fnt AS LONG: fnt = _LOADFONT(FONT_FILE, 16)
+PRINT "Font loaded: "; fnt > 0
+
+' 32bpp renders the anti-aliased glyphs and 8bpp the monochrome ones
+TestRenderCache fnt, 32
+TestRenderCache fnt, 256
+
+_FONT 16
+_FREEFONT fnt
+
+SYSTEM
+
+
+SUB TestRenderCache (fnt AS LONG, mode AS LONG)
+    DIM AS STRING blank, first, again, evicted
+    DIM i AS LONG
+
+    blank = RenderText(fnt, mode, "")
+    first = RenderText(fnt, mode, SAMPLE_TEXT)
+    again = RenderText(fnt, mode, SAMPLE_TEXT)
+
+    ' More distinct strings than the cache holds
+    FOR i = 1 TO 300
+        evicted = RenderText(fnt, mode, "Evict" + STR$(i) + SAMPLE_TEXT)
+    NEXT
+
+    evicted = RenderText(fnt, mode, SAMPLE_TEXT)
+
+    PRINT "Mode"; mode; "drawn: "; first <> blank; ", cached: "; again = first; ", after eviction: "; evicted = first
+END SUB
+
+
+FUNCTION RenderText$ (fnt AS LONG, mode AS LONG, text AS STRING)
+    DIM oldDest AS LONG: oldDest = _DEST
+    DIM img AS LONG: img = _NEWIMAGE(600, 40, mode)
+
+    _DEST img
+    _FONT fnt
+    _PRINTSTRING (4, 4), text
+
+    DIM m AS _MEM: m = _MEMIMAGE(img)
+    DIM pixels AS STRING: pixels = SPACE$(m.SIZE)
+    _MEMGET m, m.OFFSET, pixels
+    _MEMFREE m
+
+    _DEST oldDest
+    _FREEIMAGE img
+
+    RenderText = pixels
+END FUNCTION
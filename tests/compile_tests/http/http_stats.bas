@@ -0,0 +1,99 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+ON ERROR GOTO errorhand
+
+CONST PORT = "47126"
+
+IF COMMAND$(1) = "--serve" THEN Serve: SYSTEM
+
+DIM AS LONG h, i
+DIM AS STRING s, body
+DIM startTime AS DOUBLE
+
+' _OPENCLIENT() blocks until the response starts, so the server has to be a separate process
+SHELL _DONTWAIT CHR$(34) + COMMAND$(0) + CHR$(34) + " --serve"
+
+startTime = TIMER(0.001)
+DO
+    _LIMIT 20
+    h = _OPENCLIENT("TCP/IP:" + PORT + ":127.0.0.1")
+LOOP UNTIL h <> 0 OR ABS(TIMER(0.001) - startTime) > 10
+IF h = 0 THEN PRINT "server did not start": SYSTEM
+CLOSE h
+
+PRINT _HTTPSTATS("REQUESTS"); _HTTPSTATS("CONNECTIONS"); _HTTPSTATS("REUSED")
+
+' The server keeps the connection alive, so the second request reuses the first one's connection
+FOR i = 1 TO 2
+    h = _OPENCLIENT("http://127.0.0.1:" + PORT + "/" + _TOSTR$(i))
+
+    body = ""
+    WHILE NOT EOF(h)
+        _LIMIT 20
+        GET #h, , s
+        body = body + s
+    WEND
+    PRINT body
+
+    CLOSE h
+NEXT
+
+' The statistics are updated once the request is finished
+startTime = TIMER(0.001)
+DO WHILE _HTTPSTATS("requests") < 2 AND ABS(TIMER(0.001) - startTime) < 10
+    _LIMIT 20
+LOOP
+
+PRINT _HTTPSTATS("Requests"); _HTTPSTATS("Connections"); _HTTPSTATS("Reused")
+
+' Error, unknown statistic
+PRINT _HTTPSTATS("bytes")
+
+SYSTEM
+
+errorhand:
+PRINT "Error:"; ERR; ", Line:"; _ERRORLINE
+RESUME NEXT
+
+' A minimal keep-alive HTTP server that answers two requests
+SUB Serve
+    DIM AS LONG host, conn(1 TO 4), connCount, responses, i
+    DIM AS STRING request(1 TO 4), s, response
+    DIM startTime AS DOUBLE
+
+    response = "HTTP/1.1 200 OK" + CHR$(13) + CHR$(10) + _
+               "Content-Length: 5" + CHR$(13) + CHR$(10) + _
+               "Connection: keep-alive" + CHR$(13) + CHR$(10) + CHR$(13) + CHR$(10) + _
+               "hello"
+
+    host = _OPENHOST("TCP/IP:" + PORT)
+    IF host = 0 THEN EXIT SUB
+
+    startTime = TIMER(0.001)
+    DO WHILE responses < 2 AND ABS(TIMER(0.001) - startTime) < 20
+        _LIMIT 100
+
+        i = _OPENCONNECTION(host)
+        IF i <> 0 AND connCount < UBOUND(conn) THEN connCount = connCount + 1: conn(connCount) = i
+
+        FOR i = 1 TO connCount
+            GET #conn(i), , s
+            request(i) = request(i) + s
+
+            ' Answer every complete request header
+            DO WHILE INSTR(request(i), CHR$(13) + CHR$(10) + CHR$(13) + CHR$(10))
+                request(i) = MID$(request(i), INSTR(request(i), CHR$(13) + CHR$(10) + CHR$(13) + CHR$(10)) + 4)
+                PUT #conn(i), , response
+                responses = responses + 1
+            LOOP
+        NEXT
+    LOOP
+
+    ' Give the client time to read the last response before the connections go away
+    _DELAY 1
+
+    FOR i = 1 TO connCount
+        CLOSE conn(i)
+    NEXT
+    CLOSE host
+END SUB
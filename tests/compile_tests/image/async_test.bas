@@ -0,0 +1,61 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+CHDIR _STARTDIR$
+
+CONST FILE_COUNT = 6
+
+DIM fileName(1 TO FILE_COUNT) AS STRING
+DIM ticket(1 TO FILE_COUNT) AS LONG
+DIM AS LONG i, syncImg, asyncImg
+
+FOR i = 1 TO FILE_COUNT
+    READ fileName(i)
+NEXT i
+
+' Queue everything first so the files are decoded in parallel
+FOR i = 1 TO FILE_COUNT
+    ticket(i) = _LOADIMAGEASYNC("./" + fileName(i), 32)
+NEXT i
+
+FOR i = 1 TO FILE_COUNT
+    asyncImg = _LOADIMAGEWAIT(ticket(i))
+    syncImg = _LOADIMAGE("./" + fileName(i), 32)
+
+    IF asyncImg < -1 THEN
+        PRINT fileName(i); ": ("; _WIDTH(asyncImg); "x"; _HEIGHT(asyncImg); ") pixels";
+        IF PixelData(asyncImg) = PixelData(syncImg) THEN PRINT ", same as _LOADIMAGE" ELSE PRINT ", different from _LOADIMAGE!"
+        _FREEIMAGE asyncImg
+    ELSE
+        PRINT fileName(i); " is not a valid image file!"
+    END IF
+
+    IF syncImg < -1 THEN _FREEIMAGE syncImg
+NEXT i
+
+' 8bpp and memory loading go through the same settings as _LOADIMAGE
+DIM fileData AS STRING
+OPEN "./lena.bmp" FOR BINARY AS #1
+fileData = SPACE$(LOF(1))
+GET #1, , fileData
+CLOSE #1
+
+i = _LOADIMAGEASYNC(fileData, 256, "memory")
+DO UNTIL _LOADIMAGEREADY(i)
+    _LIMIT 100
+LOOP
+asyncImg = _LOADIMAGEWAIT(i)
+PRINT "lena.bmp from memory: ("; _WIDTH(asyncImg); "x"; _HEIGHT(asyncImg); ") pixels,"; _PIXELSIZE(asyncImg); "byte(s) per pixel"
+_FREEIMAGE asyncImg
+
+SYSTEM
+
+DATA lena.bmp,lena.pcx,1.webp,good1.svg,cat.ico,bogus1.svg
+
+FUNCTION PixelData$ (img AS LONG)
+    DIM m AS _MEM: m = _MEMIMAGE(img)
+    DIM s AS STRING: s = SPACE$(m.SIZE)
+    _MEMGET m, m.OFFSET, s
+    _MEMFREE m
+    PixelData = s
+END FUNCTION
@@ -0,0 +1,236 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+TYPE PointRecord
+    x AS LONG
+    y AS LONG
+    c AS _UNSIGNED LONG
+END TYPE
+
+TYPE ShapeRecord
+    x1 AS LONG
+    y1 AS LONG
+    x2 AS LONG
+    y2 AS LONG
+    c AS _UNSIGNED LONG
+END TYPE
+
+' A record with a field after the ones the statements read
+TYPE TaggedPoint
+    x AS LONG
+    y AS LONG
+    c AS _UNSIGNED LONG
+    tag AS STRING * 5
+END TYPE
+
+CONST RECORD_COUNT = 500
+
+DIM SHARED points(1 TO RECORD_COUNT) AS PointRecord
+DIM SHARED shapes(1 TO RECORD_COUNT) AS ShapeRecord
+DIM SHARED lastError AS LONG
+
+RANDOMIZE 1
+
+PRINT "32-bit opaque: "; TestImage(32, &HFF000000)
+PRINT "32-bit half alpha: "; TestImage(32, &H80000000)
+PRINT "32-bit alpha: "; TestImage(32, &H4D000000)
+PRINT "8-bit: "; TestImage(256, 0)
+PRINT "VIEW: "; TestView
+
+DIM m AS _MEM, img AS LONG, i AS LONG
+DIM tagged(1 TO 3) AS TaggedPoint
+
+img = _NEWIMAGE(16, 16, 32)
+_DEST img
+
+FOR i = 1 TO 3
+    tagged(i).x = i: tagged(i).y = i: tagged(i).c = _RGB32(255, 0, 0): tagged(i).tag = "point"
+NEXT i
+m = _MEM(tagged())
+_PSETLIST m, 2
+_SOURCE img
+_DEST _CONSOLE
+IF POINT(1, 1) = _RGB32(255, 0, 0) AND POINT(2, 2) = _RGB32(255, 0, 0) AND POINT(3, 3) <> _RGB32(255, 0, 0) THEN
+    PRINT "Count: first 2 records drawn"
+ELSE
+    PRINT "Count: wrong records drawn"
+END IF
+
+' Errors 300 (count past the end) and 308 (freed block) can't be trapped, so only this one is checked
+_DEST img
+ON ERROR GOTO handler
+_PSETLIST m, -1
+ON ERROR GOTO 0
+_DEST _CONSOLE
+PRINT "Negative count: error"; lastError
+
+_MEMFREE m
+_SOURCE _CONSOLE
+_FREEIMAGE img
+SYSTEM
+
+handler:
+lastError = ERR
+RESUME NEXT
+
+' Draws the same random points, lines and boxes with PSET/LINE and with the list statements and checks the images match
+FUNCTION TestImage$ (mode AS LONG, alpha AS _UNSIGNED LONG)
+    DIM AS LONG i, a, b, w, h
+    DIM m AS _MEM
+    DIM result AS STRING
+
+    a = _NEWIMAGE(320, 200, mode)
+    b = _NEWIMAGE(320, 200, mode)
+    w = _WIDTH(a): h = _HEIGHT(a)
+
+    FOR i = 1 TO RECORD_COUNT
+        points(i).x = INT(RND * (w + 40)) - 20
+        points(i).y = INT(RND * (h + 40)) - 20
+        points(i).c = RandomColor(alpha)
+    NEXT i
+
+    _DEST a
+    FOR i = 1 TO RECORD_COUNT
+        PSET (points(i).x, points(i).y), points(i).c
+    NEXT i
+    _DEST b
+    m = _MEM(points())
+    _PSETLIST m
+    _MEMFREE m
+    result = result + " points " + Verdict(a, b)
+
+    ' Random boxes, some of them partly or completely off the image
+    RandomShapes w, h, alpha, 0
+    _DEST a
+    FOR i = 1 TO RECORD_COUNT
+        LINE (shapes(i).x1, shapes(i).y1)-(shapes(i).x2, shapes(i).y2), shapes(i).c, BF
+    NEXT i
+    _DEST b
+    m = _MEM(shapes())
+    _BOXLIST m
+    _MEMFREE m
+    result = result + ", boxes " + Verdict(a, b)
+
+    ' Horizontal, vertical and 45 degree lines, horizontal ones are drawn as a single span
+    RandomShapes w, h, alpha, -1
+    _DEST a
+    FOR i = 1 TO RECORD_COUNT
+        LINE (shapes(i).x1, shapes(i).y1)-(shapes(i).x2, shapes(i).y2), shapes(i).c
+    NEXT i
+    _DEST b
+    m = _MEM(shapes())
+    _LINELIST m
+    _MEMFREE m
+    result = result + ", lines " + Verdict(a, b)
+
+    ' Lines at any angle, _LINELIST steps them the same way LINE does
+    RandomShapes w, h, alpha, 0
+    _DEST a
+    FOR i = 1 TO RECORD_COUNT
+        LINE (shapes(i).x1, shapes(i).y1)-(shapes(i).x2, shapes(i).y2), shapes(i).c
+    NEXT i
+    _DEST b
+    m = _MEM(shapes())
+    _LINELIST m
+    _MEMFREE m
+    result = result + ", any angle " + Verdict(a, b)
+
+    _DEST _CONSOLE
+    _FREEIMAGE a
+    _FREEIMAGE b
+
+    TestImage = result
+END FUNCTION
+
+FUNCTION TestView$
+    DIM AS LONG i, a, b
+    DIM m AS _MEM
+
+    a = _NEWIMAGE(100, 100, 32)
+    b = _NEWIMAGE(100, 100, 32)
+
+    FOR i = 1 TO RECORD_COUNT
+        points(i).x = INT(RND * 100) - 20
+        points(i).y = INT(RND * 100) - 20
+        points(i).c = RandomColor(&HFF000000)
+    NEXT i
+    RandomShapes 80, 80, &HFF000000, 0
+
+    _DEST a
+    VIEW (10, 10)-(60, 70)
+    FOR i = 1 TO RECORD_COUNT
+        PSET (points(i).x, points(i).y), points(i).c
+    NEXT i
+    FOR i = 1 TO RECORD_COUNT
+        LINE (shapes(i).x1, shapes(i).y1)-(shapes(i).x2, shapes(i).y2), shapes(i).c, BF
+    NEXT i
+    FOR i = 1 TO RECORD_COUNT
+        LINE (shapes(i).x2, shapes(i).y1)-(shapes(i).x1, shapes(i).y2), shapes(i).c XOR &HFFFFFF
+    NEXT i
+
+    _DEST b
+    VIEW (10, 10)-(60, 70)
+    m = _MEM(points())
+    _PSETLIST m
+    _MEMFREE m
+    m = _MEM(shapes())
+    _BOXLIST m
+    _MEMFREE m
+    FOR i = 1 TO RECORD_COUNT
+        SWAP shapes(i).x1, shapes(i).x2
+        shapes(i).c = shapes(i).c XOR &HFFFFFF
+    NEXT i
+    m = _MEM(shapes())
+    _LINELIST m
+    _MEMFREE m
+
+    _DEST _CONSOLE
+    TestView = Verdict(a, b)
+    _FREEIMAGE a
+    _FREEIMAGE b
+END FUNCTION
+
+SUB RandomShapes (w AS LONG, h AS LONG, alpha AS _UNSIGNED LONG, straight AS LONG)
+    DIM AS LONG i, l
+
+    FOR i = 1 TO RECORD_COUNT
+        shapes(i).x1 = INT(RND * (w + 40)) - 20
+        shapes(i).y1 = INT(RND * (h + 40)) - 20
+        IF straight THEN
+            l = INT(RND * 100) - 50
+            SELECT CASE i MOD 3
+                CASE 0: shapes(i).x2 = shapes(i).x1 + l: shapes(i).y2 = shapes(i).y1
+                CASE 1: shapes(i).x2 = shapes(i).x1: shapes(i).y2 = shapes(i).y1 + l
+                CASE 2: shapes(i).x2 = shapes(i).x1 + l: shapes(i).y2 = shapes(i).y1 + l
+            END SELECT
+        ELSE
+            shapes(i).x2 = INT(RND * (w + 40)) - 20
+            shapes(i).y2 = INT(RND * (h + 40)) - 20
+        END IF
+        shapes(i).c = RandomColor(alpha)
+    NEXT i
+END SUB
+
+FUNCTION RandomColor~& (alpha AS _UNSIGNED LONG)
+    IF alpha THEN
+        RandomColor = alpha OR INT(RND * &H1000000)
+    ELSE
+        RandomColor = INT(RND * 256)
+    END IF
+END FUNCTION
+
+FUNCTION Verdict$ (a AS LONG, b AS LONG)
+    DIM AS _MEM ma, mb
+    DIM AS STRING da, db
+
+    ma = _MEMIMAGE(a)
+    mb = _MEMIMAGE(b)
+    da = SPACE$(ma.SIZE)
+    db = SPACE$(mb.SIZE)
+    _MEMGET ma, ma.OFFSET, da
+    _MEMGET mb, mb.OFFSET, db
+    _MEMFREE ma
+    _MEMFREE mb
+
+    IF da = db THEN Verdict = "match" ELSE Verdict = "differ"
+END FUNCTION
@@ -0,0 +1,76 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+CHDIR _STARTDIR$
+
+CONST TEST_FILE = "png_save_test_temp.png"
+
+DIM img AS LONG: img = _NEWIMAGE(257, 131, 32)
+DIM AS LONG x, y
+
+_DEST img
+FOR y = 0 TO _HEIGHT(img) - 1
+    FOR x = 0 TO _WIDTH(img) - 1
+        PSET (x, y), _RGBA32(x AND 255, y * 2, (x XOR y) AND 255, 128 + (x + y) MOD 128)
+    NEXT
+NEXT
+LINE (10, 10)-(120, 90), _RGB32(255, 0, 0), BF
+CIRCLE (180, 60), 40, _RGB32(0, 255, 0)
+_DEST _CONSOLE
+
+DIM AS LONG defaultSize, size0, size1, size9, size42
+defaultSize = CheckLevel(img, "")
+size0 = CheckLevel(img, "level=0")
+size1 = CheckLevel(img, "level=1")
+size9 = CheckLevel(img, "PNG,LEVEL:9")
+size42 = CheckLevel(img, "level=42")
+
+' Level 0 only stores the data, so it must be the largest. Levels past 9 are clamped to 9
+PRINT "Level 0 larger than level 1:"; size0 > size1
+PRINT "Level 0 larger than level 9:"; size0 > size9
+PRINT "Level 0 larger than default:"; size0 > defaultSize
+PRINT "Level 42 same as level 9:"; size42 = size9
+
+_FREEIMAGE img
+
+SYSTEM
+
+' Saves and reloads the image and returns the size of the file
+FUNCTION CheckLevel& (img AS LONG, requirements AS STRING)
+    _SAVEIMAGE TEST_FILE, img, requirements
+
+    DIM fileNum AS LONG: fileNum = FREEFILE
+    OPEN TEST_FILE FOR BINARY ACCESS READ AS fileNum
+    CheckLevel = LOF(fileNum)
+    CLOSE fileNum
+
+    DIM loaded AS LONG: loaded = _LOADIMAGE(TEST_FILE, 32)
+    KILL TEST_FILE
+
+    IF loaded >= -1 THEN
+        PRINT "'"; requirements; "': load failed"
+        EXIT FUNCTION
+    END IF
+
+    IF _WIDTH(loaded) <> _WIDTH(img) OR _HEIGHT(loaded) <> _HEIGHT(img) THEN
+        PRINT "'"; requirements; "': size mismatch"
+    ELSE
+        DIM AS _MEM m1, m2
+        m1 = _MEMIMAGE(img)
+        m2 = _MEMIMAGE(loaded)
+
+        DIM AS STRING s1, s2
+        s1 = SPACE$(m1.SIZE): _MEMGET m1, m1.OFFSET, s1
+        s2 = SPACE$(m2.SIZE): _MEMGET m2, m2.OFFSET, s2
+
+        IF s1 = s2 THEN
+            PRINT "'"; requirements; "': identical"
+        ELSE
+            PRINT "'"; requirements; "': pixel mismatch"
+        END IF
+
+        _MEMFREE m1
+        _MEMFREE m2
+    END IF
+
+    _FREEIMAGE loaded
+END FUNCTION
@@ -0,0 +1,80 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+CHDIR _STARTDIR$
+
+ON ERROR GOTO error_handler
+
+DIM AS LONG src, loaded, scaled, dst, errorCode
+
+src = _LOADIMAGE("1bpp.ico.bmp", 32)
+PRINT "Source:"; _WIDTH(src); "x"; _HEIGHT(src)
+
+' MMPX only compares colors, so it gives the same result as scaling while loading
+loaded = _LOADIMAGE("1bpp.ico.bmp", 32, "mmpx2")
+scaled = _SCALEIMAGE(src, "mmpx2")
+PRINT "MMPX2:"; _WIDTH(scaled); "x"; _HEIGHT(scaled); SameImage(loaded, scaled)
+_FREEIMAGE loaded
+
+' The statement form writes into an existing image of the right size
+dst = _NEWIMAGE(_WIDTH(src) * 2, _HEIGHT(src) * 2, 32)
+_SCALEIMAGE src, dst, "MMPX2"
+PRINT "Into existing image:"; SameImage(scaled, dst)
+_FREEIMAGE scaled
+
+' Every scaler gives the same result as scaling while loading, also on a colorful image where the channel order matters
+DIM scaler AS STRING
+DIM colorful AS LONG: colorful = _LOADIMAGE("24bpp.ico.bmp", 32)
+RESTORE scaler_list
+READ scaler
+WHILE LEN(scaler)
+    scaled = _SCALEIMAGE(colorful, scaler)
+    loaded = _LOADIMAGE("24bpp.ico.bmp", 32, scaler)
+    PRINT scaler; ":"; _WIDTH(scaled); "x"; _HEIGHT(scaled); SameImage(loaded, scaled)
+    _FREEIMAGE loaded
+    _FREEIMAGE scaled
+    READ scaler
+WEND
+_FREEIMAGE colorful
+
+' Wrong destination size
+errorCode = 0
+_SCALEIMAGE src, dst, "hq3xa"
+PRINT "Wrong size error:"; errorCode
+
+' Unknown scaler
+errorCode = 0
+scaled = _SCALEIMAGE(src, "bilinear")
+PRINT "Unknown scaler error:"; errorCode
+
+' "none" is accepted by _LOADIMAGE but is not a scaler
+errorCode = 0
+scaled = _SCALEIMAGE(src, "none")
+PRINT "No scaler error:"; errorCode
+
+_FREEIMAGE dst
+_FREEIMAGE src
+SYSTEM
+
+error_handler:
+errorCode = ERR
+RESUME NEXT
+
+scaler_list:
+DATA "sxbr2","sxbr3","sxbr4","mmpx2","hq2xa","hq2xb","hq3xa","hq3xb",""
+
+FUNCTION SameImage& (a AS LONG, b AS LONG)
+    IF _WIDTH(a) <> _WIDTH(b) OR _HEIGHT(a) <> _HEIGHT(b) THEN EXIT FUNCTION
+
+    DIM AS _MEM m1, m2
+    m1 = _MEMIMAGE(a)
+    m2 = _MEMIMAGE(b)
+
+    DIM AS STRING s1, s2
+    s1 = SPACE$(m1.SIZE): _MEMGET m1, m1.OFFSET, s1
+    s2 = SPACE$(m2.SIZE): _MEMGET m2, m2.OFFSET, s2
+
+    SameImage = s1 = s2
+
+    _MEMFREE m1
+    _MEMFREE m2
+END FUNCTION
@@ -0,0 +1,51 @@
+$CONSOLE:ONLY
+
+OPTION _EXPLICIT
+
+DIM AS LONG i, h, chunkSize
+DIM AS STRING plain, compressed, decompressed
+
+FOR i = 1 TO 20000
+    plain = plain + "Line" + STR$(i) + CHR$(10)
+NEXT i
+
+' Compress in chunks and check the result with _INFLATE$
+h = _DEFLATEOPEN(9)
+FOR i = 1 TO LEN(plain) STEP 1000
+    compressed = compressed + _DEFLATECHUNK$(h, MID$(plain, i, 1000))
+NEXT i
+compressed = compressed + _DEFLATECHUNK$(h, "", _TRUE)
+_DEFLATECLOSE h
+
+IF _STRCMP(_INFLATE$(compressed), plain) = _EQUAL THEN
+    PRINT "Deflate stream test passed."
+ELSE
+    PRINT "Deflate stream test failed!"
+END IF
+
+' Decompress in chunks of different sizes
+FOR chunkSize = 1 TO 4097 STEP 512
+    decompressed = ""
+    h = _INFLATEOPEN
+    FOR i = 1 TO LEN(compressed) STEP chunkSize
+        IF _INFLATEEOF(h) THEN PRINT "Inflate stream ended early!"
+        decompressed = decompressed + _INFLATECHUNK$(h, MID$(compressed, i, chunkSize))
+    NEXT i
+
+    IF _STRCMP(decompressed, plain) = _EQUAL AND _INFLATEEOF(h) THEN
+        PRINT USING "Inflate stream test #### passed."; chunkSize
+    ELSE
+        PRINT USING "Inflate stream test #### failed!"; chunkSize
+    END IF
+    _INFLATECLOSE h
+NEXT chunkSize
+
+' Large data without an original size
+plain = STRING$(30000000, "Q")
+IF _STRCMP(_INFLATE$(_DEFLATE$(plain)), plain) = _EQUAL THEN
+    PRINT "Large inflate test passed."
+ELSE
+    PRINT "Large inflate test failed!"
+END IF
+
+SYSTEM
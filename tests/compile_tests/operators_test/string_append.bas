@@ -0,0 +1,49 @@
+$CONSOLE:ONLY
+_DEFINE A-Z AS LONG
+OPTION _EXPLICIT
+
+DIM AS LONG i, ok
+DIM AS STRING s, t, u
+DIM f AS STRING * 8
+
+' Long string built one piece at a time, with other strings created in between
+FOR i = 1 TO 100000
+    s = s + CHR$(65 + i MOD 26)
+    IF i MOD 1000 = 0 THEN t = t + "x" + LTRIM$(STR$(i \ 1000))
+NEXT
+PRINT LEN(s); LEFT$(s, 5); RIGHT$(s, 5)
+PRINT LEN(t); LEFT$(t, 8)
+
+ok = -1
+FOR i = 1 TO 100000
+    IF ASC(s, i) <> 65 + i MOD 26 THEN ok = 0: EXIT FOR
+NEXT
+PRINT ok
+
+' Several operands, literals containing brackets and quotes, and the destination on the right
+u = "a"
+u = u + "(" + CHR$(34) + ")" + u
+u = u + MID$(u, 2, 3) + u
+PRINT u
+
+u = u + ""
+u = u + u
+PRINT u
+
+' Fixed length strings keep their length
+f = "ab"
+f = f + "cdefghijk"
+PRINT f; LEN(f)
+
+' Variables passed by reference
+Grow u
+PRINT u
+
+SYSTEM
+
+SUB Grow (s AS STRING)
+    DIM i AS LONG
+    FOR i = 1 TO 3
+        s = s + LTRIM$(STR$(i))
+    NEXT
+END SUB
@@ -0,0 +1,52 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+CONST W = 65535
+
+DIM AS LONG img, x, count
+
+' As wide as an image can be, the old per-pixel fill's 65536 entry queues could not hold fills this size
+img = _NEWIMAGE(W, 5, 32)
+_DEST img
+CLS , _RGB32(0, 0, 0)
+
+' Wall off the top two rows and punch a one pixel hole through the wall at the far right
+LINE (0, 2)-(W - 1, 2), _RGB32(255, 255, 255)
+PSET (W - 1, 2), _RGB32(0, 0, 0)
+
+PAINT (0, 4), _RGB32(255, 0, 0), _RGB32(255, 255, 255)
+
+_SOURCE img
+_DEST _CONSOLE
+PRINT HEX$(POINT(0, 0)); " "; HEX$(POINT(W \ 2, 1)); " "; HEX$(POINT(W - 1, 2)); " "; HEX$(POINT(100, 2)); " "; HEX$(POINT(0, 4))
+_DEST img
+
+' Alpha-blended fill colour: every pixel of the region must be blended exactly once
+CLS , _RGB32(0, 0, 255)
+LINE (0, 2)-(W - 1, 2), _RGB32(255, 255, 255)
+PAINT (10, 0), _RGBA32(255, 0, 0, 128), _RGB32(255, 255, 255)
+
+count = 0
+FOR x = 0 TO W - 1
+    IF POINT(x, 0) = POINT(0, 0) AND POINT(x, 1) = POINT(0, 0) THEN count = count + 1
+NEXT
+_DEST _CONSOLE
+PRINT HEX$(POINT(0, 0)); count; HEX$(POINT(0, 3))
+
+' 8-bit page with a box outline
+_FREEIMAGE img
+img = _NEWIMAGE(320, 200, 13)
+_DEST img
+_SOURCE img
+LINE (110, 50)-(210, 150), 15, B
+PAINT (160, 100), 4, 15
+
+count = 0
+FOR x = 0 TO 319
+    IF POINT(x, 100) = 4 THEN count = count + 1
+NEXT
+_DEST _CONSOLE
+PRINT count; POINT(0, 0); POINT(160, 100)
+
+_FREEIMAGE img
+SYSTEM
@@ -0,0 +1,77 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+' A multi-line string printed past the bottom of the screen is scrolled in one go,
+' the result has to match printing the same lines one at a time
+
+CheckScroll 32, 0
+CheckScroll 13, 0
+CheckScroll 0, 0
+CheckScroll 32, 1
+CheckScroll 13, 1
+CheckScroll 0, 1
+
+SYSTEM
+
+SUB CheckScroll (mode AS LONG, viewPrint AS LONG)
+    DIM AS LONG one, batched, i, same
+    DIM AS STRING text
+
+    FOR i = 1 TO 100
+        text = text + "Line" + STR$(i)
+        IF i MOD 7 = 0 THEN text = text + CHR$(13) + CHR$(10) ELSE text = text + CHR$(10)
+        IF i MOD 11 = 0 THEN text = text + STRING$(100, "x") + CHR$(10) ' wraps
+    NEXT
+    text = text + "Last"
+
+    one = NewScreen(mode, viewPrint)
+    FOR i = 1 TO LEN(text)
+        PRINT MID$(text, i, 1);
+    NEXT
+    PRINT
+
+    batched = NewScreen(mode, viewPrint)
+    PRINT text
+
+    same = SameImage(one, batched)
+
+    _DEST _CONSOLE
+    PRINT "Mode"; mode; "VIEW PRINT"; viewPrint; ": ";
+    IF same THEN PRINT "same" ELSE PRINT "different"
+
+    _FREEIMAGE one
+    _FREEIMAGE batched
+END SUB
+
+FUNCTION NewScreen& (mode AS LONG, viewPrint AS LONG)
+    DIM img AS LONG
+
+    IF mode = 0 THEN img = _NEWIMAGE(80, 25, 0) ELSE img = _NEWIMAGE(320, 200, mode)
+    _DEST img
+    COLOR 14, 1
+    CLS
+    IF viewPrint THEN VIEW PRINT 3 TO 10 ' 320x200 only has 12 rows of the default 16 pixel font
+    NewScreen = img
+END FUNCTION
+
+FUNCTION SameImage& (a AS LONG, b AS LONG)
+    DIM AS _MEM ma, mb
+    DIM AS STRING da, db
+    DIM AS LONG rowA, colA
+
+    ma = _MEMIMAGE(a)
+    mb = _MEMIMAGE(b)
+    da = SPACE$(ma.SIZE)
+    db = SPACE$(mb.SIZE)
+    _MEMGET ma, ma.OFFSET, da
+    _MEMGET mb, mb.OFFSET, db
+    _MEMFREE ma
+    _MEMFREE mb
+
+    ' the cursor has to end up in the same place too
+    _DEST a
+    rowA = CSRLIN
+    colA = POS(0)
+    _DEST b
+    SameImage = da = db AND rowA = CSRLIN AND colA = POS(0)
+END FUNCTION
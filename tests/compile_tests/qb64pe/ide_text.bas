@@ -0,0 +1,107 @@
+DEFLNG A-Z
+$Console:Only
+
+'$include:'../../../source/ide/text/text_global.bas'
+
+' A plain array holding the lines the IDE text buffer should contain
+ReDim Shared Model(0) As String
+Dim Shared ModelN As Long
+
+' Insert at the start, in the middle and at the end, enough lines to grow the buffer a few times
+idetextnew 0
+ModelN = 0
+For i = 1 To 100
+    Select Case i Mod 3
+        Case 0: InsertLine 1, "start" + Str$(i)
+        Case 1: InsertLine iden \ 2 + 1, "middle" + Str$(i)
+        Case 2: InsertLine iden + 1, "end" + Str$(i)
+    End Select
+Next
+Print "Insert:"; iden; Check$
+
+' Delete from the start, the middle and the end
+For i = 1 To 60
+    Select Case i Mod 3
+        Case 0: DeleteLine 1
+        Case 1: DeleteLine (iden + 1) \ 2
+        Case 2: DeleteLine iden
+    End Select
+Next
+Print "Delete:"; iden; Check$
+
+' Lines inserted after deletes reuse the freed slots
+For i = 1 To 30
+    Select Case i Mod 3
+        Case 0: InsertLine 1, "again" + Str$(i)
+        Case 1: InsertLine iden \ 2 + 1, ""
+        Case 2: InsertLine iden + 1, String$(i, 65 + i)
+    End Select
+Next
+Print "Insert after delete:"; iden; Check$
+
+' Export and import again, edit the imported text at the start, the middle and the end, and round-trip once more
+t$ = idetextexport$
+idetextimport t$
+Print "Import:"; iden; Check$; ", same export:"; idetextexport$ = t$
+
+InsertLine 1, "first"
+InsertLine iden \ 2 + 1, "halfway"
+InsertLine iden + 1, "last"
+DeleteLine 2
+DeleteLine iden \ 2
+DeleteLine iden - 1
+idetextimport idetextexport$
+Print "Edit and import:"; iden; Check$
+
+' Deleting everything and importing nothing both leave a single empty line
+Do While iden: DeleteLine 1: Loop
+Print "Delete all:"; iden; Len(idetextexport$)
+idetextimport ""
+Print "Import empty:"; iden; Len(IdeLineText(idetextslot(1)))
+
+' idetextclear starts over with one empty line too
+idetextclear
+ModelN = 1: Model(1) = ""
+InsertLine 1, "only"
+DeleteLine 2
+Print "Clear:"; iden; Check$
+
+System
+
+Sub InsertLine (i, text$)
+    l = i
+    idetextinsert l, text$
+
+    If ModelN = UBound(Model) Then ReDim _Preserve Model(ModelN * 2 + 1) As String
+    For j = ModelN To l Step -1
+        Model(j + 1) = Model(j)
+    Next
+    Model(l) = text$
+    ModelN = ModelN + 1
+End Sub
+
+Sub DeleteLine (i)
+    l = i ' i can be iden itself, which idetextdelete changes
+    idetextdelete l
+
+    For j = l To ModelN - 1
+        Model(j) = Model(j + 1)
+    Next
+    ModelN = ModelN - 1
+End Sub
+
+' Compares the buffer to the model line by line and to the undo format built from the model
+Function Check$
+    If iden <> ModelN Then Check$ = " line count differs": Exit Function
+
+    For i = 1 To ModelN
+        If IdeLineText(idetextslot(i)) <> Model(i) Then Check$ = " line" + Str$(i) + " differs": Exit Function
+        expected$ = expected$ + MKL$(Len(Model(i))) + Model(i) + MKL$(Len(Model(i)))
+    Next
+
+    If idetextexport$ <> expected$ Then Check$ = " export differs": Exit Function
+
+    Check$ = " OK"
+End Function
+
+'$include:'../../../source/ide/text/text_methods.bas'
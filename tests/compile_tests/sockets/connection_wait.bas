@@ -0,0 +1,52 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+DIM AS LONG host, client, server, h, i
+DIM AS STRING big, received, chunk
+
+host = _OPENHOST("TCP/IP:47124")
+client = _OPENCLIENT("TCP/IP:47124:localhost")
+PRINT host <> 0; client <> 0
+
+' The host reports a pending connection
+h = _CONNECTIONWAIT(5)
+PRINT h = host
+server = _OPENCONNECTION(host)
+PRINT server <> 0
+
+' Nothing to read yet, so waiting on the server connection times out
+PRINT _CONNECTIONWAIT(0.1, server)
+
+' Data sent by the client wakes up the server connection
+chunk = "hello"
+PUT #client, , chunk
+h = _CONNECTIONWAIT(5)
+PRINT h = server
+GET #server, , chunk
+PRINT chunk
+
+' A PUT larger than the OS buffers is queued and sent while the other side reads
+big = SPACE$(16 * 1024 * 1024)
+FOR i = 1 TO LEN(big) STEP 4096
+    MID$(big, i, 1) = CHR$(65 + (i \ 4096) MOD 26)
+NEXT i
+PUT #client, , big
+PRINT _CONNECTED(client)
+
+DO WHILE LEN(received) < LEN(big)
+    h = _CONNECTIONWAIT(5)
+    IF h = 0 THEN PRINT "timed out": EXIT DO
+    IF h = server THEN
+        GET #server, , chunk
+        received = received + chunk
+    END IF
+LOOP
+PRINT LEN(received) = LEN(big); received = big
+
+' Closing the client is reported as well
+CLOSE client
+h = _CONNECTIONWAIT(5, server)
+PRINT h = server; _CONNECTED(server)
+
+CLOSE server, host
+SYSTEM
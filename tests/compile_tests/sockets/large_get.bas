@@ -0,0 +1,36 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+DIM AS LONG host, client, server, i
+DIM big AS STRING
+DIM received AS STRING * 83886080
+DIM startTime AS DOUBLE
+
+host = _OPENHOST("TCP/IP:47125")
+client = _OPENCLIENT("TCP/IP:47125:localhost")
+server = _OPENCONNECTION(host)
+startTime = TIMER(0.001)
+DO WHILE server = 0 AND ABS(TIMER(0.001) - startTime) < 5
+    _LIMIT 100
+    server = _OPENCONNECTION(host)
+LOOP
+PRINT host <> 0; client <> 0; server <> 0
+
+'' A fixed length GET (80MB) bigger than the stream's usual 64MB input buffer limit
+big = SPACE$(LEN(received))
+FOR i = 1 TO LEN(big) STEP 4096
+    MID$(big, i, 1) = CHR$(65 + (i \ 4096) MOD 26)
+NEXT i
+PUT #client, , big
+
+startTime = TIMER(0.001)
+DO
+    GET #server, , received
+    IF NOT EOF(server) THEN EXIT DO
+    IF ABS(TIMER(0.001) - startTime) > 30 THEN PRINT "timed out": EXIT DO
+    i = _CONNECTIONWAIT(0.01, client) ' sends more of the client's queued PUT
+LOOP
+PRINT received = big
+
+CLOSE client, server, host
+SYSTEM
@@ -0,0 +1,48 @@
+$CONSOLE:ONLY
+OPTION _EXPLICIT
+
+CONST PIECE_SIZE = 4096
+
+DIM AS LONG host, client, server, i, bad, pieces
+DIM AS _INTEGER64 position
+DIM big AS STRING
+DIM piece AS STRING * PIECE_SIZE
+DIM startTime AS DOUBLE
+
+host = _OPENHOST("TCP/IP:47127")
+client = _OPENCLIENT("TCP/IP:47127:localhost")
+server = _OPENCONNECTION(host)
+startTime = TIMER(0.001)
+DO WHILE server = 0 AND ABS(TIMER(0.001) - startTime) < 5
+    _LIMIT 100
+    server = _OPENCONNECTION(host)
+LOOP
+PRINT host <> 0; client <> 0; server <> 0
+
+' The client sends a lot more than the receive buffer's 64MB limit and keeps sending faster than it is read, so the
+' buffer stays full while it is read in small pieces. Each piece must not cost a move of the whole buffer.
+big = SPACE$(128 * 1024 * 1024)
+FOR i = 1 TO LEN(big) STEP 4096
+    MID$(big, i, 1) = CHR$(65 + (i \ 4096) MOD 26)
+NEXT i
+PUT #client, , big
+
+position = 1
+startTime = TIMER(0.001)
+DO WHILE position <= LEN(big)
+    GET #server, , piece
+    IF EOF(server) THEN
+        i = _CONNECTIONWAIT(0.001, client) ' sends more of the client's queued PUT
+    ELSE
+        IF piece <> MID$(big, position, PIECE_SIZE) THEN bad = bad + 1
+        position = position + PIECE_SIZE
+        pieces = pieces + 1
+        IF pieces MOD 64 = 0 THEN i = _CONNECTIONWAIT(0.001, client)
+    END IF
+
+    IF ABS(TIMER(0.001) - startTime) > 60 THEN PRINT "timed out": EXIT DO
+LOOP
+PRINT position > LEN(big); bad
+
+CLOSE client, server, host
+SYSTEM
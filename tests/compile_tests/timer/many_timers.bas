@@ -0,0 +1,40 @@
+$Console:Only
+
+Dim Shared fired(1 To 16) As Long
+Dim t(1 To 16) As Long
+
+For i = 1 To 16
+    t(i) = _FreeTimer
+    On Timer(t(i), 0.25) Tick i
+    Timer(t(i)) On
+Next
+
+' A long timer turned on and off many times should not hold up the others
+slow = _FreeTimer
+On Timer(slow, 60) Tick 1
+For i = 1 To 10000
+    Timer(slow) On
+    Timer(slow) Off
+Next
+
+' Freed timers no longer trigger
+For i = 9 To 16
+    Timer(t(i)) Free
+Next
+
+_Delay 1.1
+
+For i = 1 To 16
+    If i <= 8 Then
+        If fired(i) < 3 Or fired(i) > 5 Then Print "Timer"; i; "triggered"; fired(i); "times"
+    Else
+        If fired(i) <> 0 Then Print "Freed timer"; i; "triggered"
+    End If
+Next
+
+Print "Done!"
+System
+
+Sub Tick (n As Long)
+    fired(n) = fired(n) + 1
+End Sub
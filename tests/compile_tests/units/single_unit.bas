@@ -0,0 +1,13 @@
+$CONSOLE:ONLY
+CHDIR _STARTDIR$
+
+' Too small to be split into code units, so no unit list may be left behind for the Makefile
+' (one left over from an earlier, larger program would link that program's units in)
+PRINT "Unit list: "; _FILEEXISTS("../../../internal/temp/units.mk")
+PRINT "Sum:"; Add(2, 3)
+
+SYSTEM
+
+FUNCTION Add& (a AS LONG, b AS LONG)
+    Add = a + b
+END FUNCTION
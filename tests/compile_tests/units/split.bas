@@ -0,0 +1,979 @@
+DEFLNG A-Z
+$CONSOLE:ONLY
+CHDIR _STARTDIR$
+
+' Large enough (more than 256KB of generated SUB/FUNCTION code) to be compiled as several code units,
+' see source/emit/units.bas. The SUBs and FUNCTIONs use the shared state of the main module and call
+' each other across units
+
+TYPE Tally
+    calls AS LONG
+    text AS STRING
+END TYPE
+
+DIM SHARED words(1 TO 8) AS STRING, tally AS Tally, errorCount AS LONG
+
+ON ERROR GOTO handler
+
+FOR i = 1 TO 8: READ words(i): NEXT
+DATA alpha,bravo,charlie,delta,echo,foxtrot,golf,hotel
+
+PRINT "Chain:"; Part48(7)
+PRINT "Calls:"; tally.calls
+PRINT "Text: "; LEFT$(tally.text, 40)
+
+FOR i = 1 TO 3: Counter: NEXT
+PrintNumbers
+
+' An error raised inside a unit is handled by the main module
+Fail
+PRINT "Errors:"; errorCount
+
+' The build tree still has the unit list of this program
+PRINT "Units listed: "; INSTR(_READFILE$("../../../internal/temp/units.mk"), "unit2.o") > 0
+
+SYSTEM
+
+handler:
+errorCount = errorCount + 1
+RESUME NEXT
+
+SUB Counter
+    STATIC n AS LONG
+    n = n + 1
+    PRINT "Counter:"; n
+END SUB
+
+SUB PrintNumbers
+    DIM i AS LONG, v AS LONG
+    RESTORE numbers
+    FOR i = 1 TO 3
+        READ v
+        GOSUB show
+    NEXT
+    EXIT SUB
+
+    show:
+    PRINT "Number:"; v
+    RETURN
+
+    numbers:
+    DATA 11,22,33
+END SUB
+
+SUB Fail
+    ERROR 5
+    ERROR 6
+END SUB
+
+FUNCTION Part1& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 1 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 1) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 1) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 1 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 1) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 1) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 1 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 1) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 1) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 1 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 1) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 1) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 1 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 1) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 1) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 1 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 1) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 1) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part1 = LEN(s) + LEN(t)
+END FUNCTION
+
+FUNCTION Part2& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 2 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 2) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 2) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 2 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 2) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 2) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 2 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 2) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 2) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 2 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 2) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 2) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 2 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 2) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 2) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 2 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 2) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 2) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part2 = LEN(s) + LEN(t) + Part1(seed + 1)
+END FUNCTION
+
+FUNCTION Part3& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 3 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 3) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 3) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 3 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 3) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 3) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 3 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 3) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 3) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 3 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 3) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 3) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 3 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 3) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 3) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 3 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 3) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 3) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part3 = LEN(s) + LEN(t) + Part2(seed + 1)
+END FUNCTION
+
+FUNCTION Part4& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 4 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 4) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 4) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 4 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 4) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 4) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 4 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 4) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 4) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 4 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 4) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 4) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 4 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 4) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 4) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 4 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 4) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 4) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part4 = LEN(s) + LEN(t) + Part3(seed + 1)
+END FUNCTION
+
+FUNCTION Part5& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 5 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 5) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 5) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 5 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 5) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 5) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 5 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 5) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 5) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 5 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 5) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 5) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 5 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 5) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 5) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 5 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 5) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 5) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part5 = LEN(s) + LEN(t) + Part4(seed + 1)
+END FUNCTION
+
+FUNCTION Part6& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 6 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 6) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 6) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 6 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 6) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 6) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 6 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 6) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 6) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 6 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 6) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 6) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 6 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 6) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 6) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 6 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 6) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 6) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part6 = LEN(s) + LEN(t) + Part5(seed + 1)
+END FUNCTION
+
+FUNCTION Part7& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 7 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 7) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 7) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 7 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 7) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 7) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 7 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 7) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 7) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 7 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 7) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 7) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 7 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 7) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 7) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 7 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 7) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 7) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part7 = LEN(s) + LEN(t) + Part6(seed + 1)
+END FUNCTION
+
+FUNCTION Part8& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 8 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 8) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 8) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 8 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 8) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 8) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 8 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 8) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 8) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 8 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 8) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 8) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 8 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 8) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 8) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 8 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 8) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 8) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part8 = LEN(s) + LEN(t) + Part7(seed + 1)
+END FUNCTION
+
+FUNCTION Part9& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 9 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 9) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 9) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 9 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 9) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 9) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 9 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 9) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 9) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 9 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 9) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 9) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 9 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 9) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 9) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 9 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 9) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 9) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part9 = LEN(s) + LEN(t) + Part8(seed + 1)
+END FUNCTION
+
+FUNCTION Part10& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 10 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 10) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 10) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 10 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 10) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 10) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 10 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 10) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 10) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 10 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 10) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 10) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 10 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 10) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 10) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 10 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 10) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 10) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part10 = LEN(s) + LEN(t) + Part9(seed + 1)
+END FUNCTION
+
+FUNCTION Part11& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 11 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 11) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 11) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 11 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 11) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 11) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 11 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 11) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 11) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 11 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 11) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 11) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 11 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 11) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 11) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 11 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 11) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 11) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part11 = LEN(s) + LEN(t) + Part10(seed + 1)
+END FUNCTION
+
+FUNCTION Part12& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 12 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 12) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 12) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 12 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 12) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 12) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 12 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 12) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 12) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 12 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 12) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 12) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 12 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 12) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 12) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 12 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 12) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 12) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part12 = LEN(s) + LEN(t) + Part11(seed + 1)
+END FUNCTION
+
+FUNCTION Part13& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 13 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 13) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 13) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 13 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 13) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 13) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 13 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 13) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 13) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 13 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 13) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 13) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 13 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 13) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 13) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 13 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 13) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 13) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part13 = LEN(s) + LEN(t) + Part12(seed + 1)
+END FUNCTION
+
+FUNCTION Part14& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 14 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 14) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 14) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 14 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 14) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 14) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 14 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 14) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 14) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 14 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 14) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 14) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 14 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 14) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 14) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 14 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 14) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 14) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part14 = LEN(s) + LEN(t) + Part13(seed + 1)
+END FUNCTION
+
+FUNCTION Part15& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 15 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 15) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 15) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 15 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 15) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 15) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 15 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 15) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 15) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 15 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 15) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 15) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 15 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 15) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 15) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 15 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 15) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 15) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part15 = LEN(s) + LEN(t) + Part14(seed + 1)
+END FUNCTION
+
+FUNCTION Part16& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 16 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 16) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 16) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 16 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 16) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 16) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 16 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 16) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 16) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 16 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 16) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 16) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 16 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 16) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 16) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 16 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 16) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 16) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part16 = LEN(s) + LEN(t) + Part15(seed + 1)
+END FUNCTION
+
+FUNCTION Part17& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 17 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 17) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 17) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 17 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 17) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 17) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 17 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 17) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 17) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 17 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 17) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 17) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 17 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 17) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 17) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 17 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 17) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 17) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part17 = LEN(s) + LEN(t) + Part16(seed + 1)
+END FUNCTION
+
+FUNCTION Part18& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 18 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 18) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 18) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 18 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 18) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 18) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 18 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 18) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 18) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 18 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 18) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 18) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 18 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 18) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 18) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 18 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 18) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 18) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part18 = LEN(s) + LEN(t) + Part17(seed + 1)
+END FUNCTION
+
+FUNCTION Part19& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 19 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 19) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 19) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 19 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 19) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 19) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 19 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 19) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 19) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 19 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 19) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 19) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 19 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 19) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 19) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 19 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 19) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 19) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part19 = LEN(s) + LEN(t) + Part18(seed + 1)
+END FUNCTION
+
+FUNCTION Part20& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 20 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 20) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 20) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 20 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 20) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 20) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 20 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 20) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 20) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 20 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 20) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 20) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 20 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 20) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 20) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 20 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 20) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 20) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part20 = LEN(s) + LEN(t) + Part19(seed + 1)
+END FUNCTION
+
+FUNCTION Part21& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 21 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 21) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 21) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 21 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 21) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 21) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 21 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 21) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 21) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 21 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 21) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 21) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 21 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 21) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 21) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 21 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 21) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 21) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part21 = LEN(s) + LEN(t) + Part20(seed + 1)
+END FUNCTION
+
+FUNCTION Part22& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 22 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 22) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 22) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 22 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 22) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 22) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 22 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 22) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 22) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 22 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 22) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 22) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 22 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 22) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 22) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 22 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 22) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 22) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part22 = LEN(s) + LEN(t) + Part21(seed + 1)
+END FUNCTION
+
+FUNCTION Part23& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 23 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 23) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 23) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 23 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 23) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 23) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 23 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 23) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 23) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 23 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 23) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 23) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 23 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 23) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 23) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 23 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 23) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 23) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part23 = LEN(s) + LEN(t) + Part22(seed + 1)
+END FUNCTION
+
+FUNCTION Part24& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 24 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 24) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 24) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 24 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 24) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 24) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 24 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 24) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 24) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 24 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 24) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 24) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 24 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 24) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 24) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 24 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 24) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 24) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part24 = LEN(s) + LEN(t) + Part23(seed + 1)
+END FUNCTION
+
+FUNCTION Part25& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 25 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 25) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 25) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 25 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 25) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 25) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 25 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 25) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 25) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 25 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 25) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 25) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 25 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 25) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 25) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 25 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 25) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 25) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part25 = LEN(s) + LEN(t) + Part24(seed + 1)
+END FUNCTION
+
+FUNCTION Part26& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 26 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 26) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 26) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 26 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 26) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 26) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 26 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 26) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 26) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 26 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 26) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 26) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 26 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 26) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 26) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 26 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 26) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 26) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part26 = LEN(s) + LEN(t) + Part25(seed + 1)
+END FUNCTION
+
+FUNCTION Part27& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 27 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 27) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 27) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 27 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 27) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 27) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 27 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 27) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 27) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 27 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 27) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 27) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 27 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 27) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 27) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 27 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 27) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 27) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part27 = LEN(s) + LEN(t) + Part26(seed + 1)
+END FUNCTION
+
+FUNCTION Part28& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 28 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 28) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 28) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 28 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 28) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 28) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 28 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 28) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 28) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 28 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 28) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 28) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 28 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 28) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 28) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 28 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 28) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 28) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part28 = LEN(s) + LEN(t) + Part27(seed + 1)
+END FUNCTION
+
+FUNCTION Part29& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 29 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 29) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 29) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 29 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 29) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 29) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 29 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 29) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 29) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 29 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 29) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 29) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 29 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 29) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 29) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 29 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 29) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 29) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part29 = LEN(s) + LEN(t) + Part28(seed + 1)
+END FUNCTION
+
+FUNCTION Part30& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 30 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 30) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 30) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 30 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 30) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 30) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 30 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 30) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 30) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 30 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 30) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 30) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 30 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 30) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 30) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 30 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 30) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 30) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part30 = LEN(s) + LEN(t) + Part29(seed + 1)
+END FUNCTION
+
+FUNCTION Part31& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 31 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 31) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 31) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 31 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 31) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 31) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 31 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 31) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 31) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 31 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 31) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 31) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 31 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 31) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 31) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 31 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 31) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 31) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part31 = LEN(s) + LEN(t) + Part30(seed + 1)
+END FUNCTION
+
+FUNCTION Part32& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 32 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 32) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 32) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 32 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 32) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 32) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 32 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 32) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 32) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 32 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 32) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 32) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 32 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 32) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 32) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 32 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 32) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 32) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part32 = LEN(s) + LEN(t) + Part31(seed + 1)
+END FUNCTION
+
+FUNCTION Part33& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 33 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 33) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 33) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 33 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 33) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 33) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 33 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 33) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 33) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 33 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 33) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 33) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 33 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 33) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 33) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 33 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 33) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 33) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part33 = LEN(s) + LEN(t) + Part32(seed + 1)
+END FUNCTION
+
+FUNCTION Part34& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 34 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 34) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 34) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 34 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 34) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 34) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 34 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 34) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 34) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 34 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 34) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 34) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 34 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 34) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 34) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 34 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 34) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 34) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part34 = LEN(s) + LEN(t) + Part33(seed + 1)
+END FUNCTION
+
+FUNCTION Part35& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 35 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 35) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 35) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 35 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 35) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 35) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 35 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 35) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 35) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 35 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 35) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 35) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 35 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 35) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 35) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 35 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 35) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 35) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part35 = LEN(s) + LEN(t) + Part34(seed + 1)
+END FUNCTION
+
+FUNCTION Part36& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 36 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 36) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 36) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 36 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 36) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 36) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 36 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 36) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 36) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 36 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 36) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 36) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 36 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 36) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 36) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 36 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 36) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 36) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part36 = LEN(s) + LEN(t) + Part35(seed + 1)
+END FUNCTION
+
+FUNCTION Part37& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 37 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 37) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 37) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 37 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 37) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 37) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 37 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 37) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 37) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 37 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 37) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 37) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 37 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 37) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 37) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 37 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 37) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 37) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part37 = LEN(s) + LEN(t) + Part36(seed + 1)
+END FUNCTION
+
+FUNCTION Part38& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 38 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 38) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 38) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 38 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 38) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 38) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 38 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 38) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 38) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 38 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 38) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 38) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 38 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 38) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 38) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 38 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 38) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 38) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part38 = LEN(s) + LEN(t) + Part37(seed + 1)
+END FUNCTION
+
+FUNCTION Part39& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 39 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 39) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 39) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 39 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 39) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 39) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 39 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 39) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 39) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 39 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 39) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 39) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 39 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 39) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 39) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 39 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 39) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 39) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part39 = LEN(s) + LEN(t) + Part38(seed + 1)
+END FUNCTION
+
+FUNCTION Part40& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 40 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 40) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 40) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 40 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 40) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 40) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 40 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 40) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 40) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 40 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 40) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 40) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 40 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 40) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 40) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 40 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 40) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 40) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part40 = LEN(s) + LEN(t) + Part39(seed + 1)
+END FUNCTION
+
+FUNCTION Part41& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 41 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 41) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 41) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 41 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 41) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 41) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 41 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 41) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 41) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 41 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 41) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 41) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 41 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 41) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 41) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 41 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 41) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 41) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part41 = LEN(s) + LEN(t) + Part40(seed + 1)
+END FUNCTION
+
+FUNCTION Part42& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 42 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 42) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 42) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 42 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 42) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 42) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 42 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 42) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 42) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 42 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 42) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 42) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 42 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 42) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 42) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 42 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 42) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 42) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part42 = LEN(s) + LEN(t) + Part41(seed + 1)
+END FUNCTION
+
+FUNCTION Part43& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 43 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 43) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 43) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 43 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 43) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 43) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 43 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 43) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 43) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 43 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 43) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 43) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 43 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 43) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 43) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 43 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 43) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 43) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part43 = LEN(s) + LEN(t) + Part42(seed + 1)
+END FUNCTION
+
+FUNCTION Part44& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 44 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 44) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 44) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 44 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 44) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 44) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 44 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 44) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 44) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 44 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 44) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 44) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 44 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 44) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 44) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 44 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 44) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 44) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part44 = LEN(s) + LEN(t) + Part43(seed + 1)
+END FUNCTION
+
+FUNCTION Part45& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 45 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 45) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 45) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 45 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 45) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 45) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 45 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 45) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 45) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 45 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 45) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 45) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 45 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 45) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 45) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 45 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 45) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 45) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part45 = LEN(s) + LEN(t) + Part44(seed + 1)
+END FUNCTION
+
+FUNCTION Part46& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 46 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 46) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 46) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 46 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 46) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 46) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 46 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 46) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 46) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 46 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 46) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 46) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 46 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 46) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 46) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 46 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 46) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 46) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part46 = LEN(s) + LEN(t) + Part45(seed + 1)
+END FUNCTION
+
+FUNCTION Part47& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 47 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 47) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 47) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 47 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 47) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 47) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 47 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 47) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 47) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 47 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 47) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 47) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 47 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 47) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 47) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 47 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 47) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 47) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part47 = LEN(s) + LEN(t) + Part46(seed + 1)
+END FUNCTION
+
+FUNCTION Part48& (seed AS LONG)
+    DIM s AS STRING, t AS STRING
+    tally.calls = tally.calls + 1
+    s = s + words(1 + (seed + 1) MOD 8) + LTRIM$(STR$(seed * 48 + 1)) + MID$(words(1 + (seed * 1) MOD 8), 2, 3) + CHR$(65 + (seed + 48) MOD 26)
+    t = UCASE$(LEFT$(s, 3)) + RIGHT$(s, 1) + STRING$(1 + (seed + 48) MOD 3, ASC(words(1 + 1 MOD 8)))
+    s = s + words(1 + (seed + 2) MOD 8) + LTRIM$(STR$(seed * 48 + 2)) + MID$(words(1 + (seed * 2) MOD 8), 2, 3) + CHR$(65 + (seed + 48) MOD 26)
+    t = UCASE$(LEFT$(s, 4)) + RIGHT$(s, 2) + STRING$(1 + (seed + 48) MOD 3, ASC(words(1 + 2 MOD 8)))
+    s = s + words(1 + (seed + 3) MOD 8) + LTRIM$(STR$(seed * 48 + 3)) + MID$(words(1 + (seed * 3) MOD 8), 2, 3) + CHR$(65 + (seed + 48) MOD 26)
+    t = UCASE$(LEFT$(s, 5)) + RIGHT$(s, 3) + STRING$(1 + (seed + 48) MOD 3, ASC(words(1 + 3 MOD 8)))
+    s = s + words(1 + (seed + 4) MOD 8) + LTRIM$(STR$(seed * 48 + 4)) + MID$(words(1 + (seed * 4) MOD 8), 2, 3) + CHR$(65 + (seed + 48) MOD 26)
+    t = UCASE$(LEFT$(s, 6)) + RIGHT$(s, 4) + STRING$(1 + (seed + 48) MOD 3, ASC(words(1 + 4 MOD 8)))
+    s = s + words(1 + (seed + 5) MOD 8) + LTRIM$(STR$(seed * 48 + 5)) + MID$(words(1 + (seed * 5) MOD 8), 2, 3) + CHR$(65 + (seed + 48) MOD 26)
+    t = UCASE$(LEFT$(s, 7)) + RIGHT$(s, 5) + STRING$(1 + (seed + 48) MOD 3, ASC(words(1 + 5 MOD 8)))
+    s = s + words(1 + (seed + 6) MOD 8) + LTRIM$(STR$(seed * 48 + 6)) + MID$(words(1 + (seed * 6) MOD 8), 2, 3) + CHR$(65 + (seed + 48) MOD 26)
+    t = UCASE$(LEFT$(s, 8)) + RIGHT$(s, 6) + STRING$(1 + (seed + 48) MOD 3, ASC(words(1 + 6 MOD 8)))
+    tally.text = LEFT$(t + tally.text, 64)
+    Part48 = LEN(s) + LEN(t) + Part47(seed + 1)
+END FUNCTION
@@ -0,0 +1,52 @@
+#!/bin/bash
+# Arg 1: qb64 location
+# Arg 2: Optional benchmark to run (the name of a .bas file in ./tests/benchmarks, without the extension)
+#
+# Compiles and runs the programs in ./tests/benchmarks and prints their timings. They are not part of
+# run_tests.sh because the timings vary by machine and there is nothing to compare them against.
+
+. ./tests/colors.sh
+
+RESULTS_DIR="./tests/results/Benchmarks"
+
+mkdir -p $RESULTS_DIR
+
+QB64=$1
+
+if [ "$#" -ge 2 ]; then
+    BENCHMARKS_TO_RUN="$2.bas"
+else
+    BENCHMARKS_TO_RUN='*.bas'
+fi
+
+result=0
+
+while IFS= read -r benchmark
+do
+    name=$(basename "$benchmark" .bas)
+    EXE="$RESULTS_DIR/$name - output"
+
+    echo "====== $name ======"
+
+    # Clear out temp folder before next compile, avoids stale compilelog files
+    rm -fr ./internal/temp/*
+    rm -f "$EXE"
+
+    "$QB64" "-f:OptimizeCppProgram=true" -q -m -x "$benchmark" -o "$EXE" 1>"$RESULTS_DIR/$name-compile_result.txt"
+
+    if [ $? -ne 0 ] || [ ! -f "$EXE" ]; then
+        cat "$RESULTS_DIR/$name-compile_result.txt"
+        cat ./internal/temp/compilelog.txt 2>/dev/null
+        echo "${RED}Compilation Error${RESET}"
+        result=1
+        continue
+    fi
+
+    # The benchmarks are run from the repository root, which is where they look for their sample files
+    if ! "$EXE"; then
+        echo "${RED}Execution Error${RESET}"
+        result=1
+    fi
+done < <(find ./tests/benchmarks -maxdepth 1 -name "$BENCHMARKS_TO_RUN" | sort)
+
+exit $result